@@ -539,7 +539,9 @@ static struct my_option my_long_options[] =
   {"password", 'p',
    "Password to use when connecting to server. If password is not given it's solicited on the tty.",
    0, 0, 0, GET_STR, OPT_ARG, 0, 0, 0, 0, 0, 0},
-  {"parallel", 'j', "Number of dump table jobs executed in parallel (only with --tab option)",
+  {"parallel", 'j', "Number of dump table jobs executed in parallel (only with "
+   "--tab or --dir option). With --single-transaction, the jobs share one "
+   "snapshot only if FLUSH TABLES WITH READ LOCK is allowed (RELOAD privilege).",
    &opt_parallel, &opt_parallel, 0, GET_UINT, REQUIRED_ARG, 0, 0, 0, 0, 0, 0},
 #ifdef _WIN32
   {"pipe", 'W', "Use named pipes to connect to server.", 0, 0, 0, GET_NO_ARG,
@@ -7605,10 +7607,33 @@ int main(int argc, char **argv)
     consistent_binlog_pos= check_consistent_binlog_pos(NULL, NULL);
   }
 
-  if ((opt_lock_all_tables || (opt_master_data && !consistent_binlog_pos) ||
-       (opt_single_transaction && flush_logs)) &&
-      do_flush_tables_read_lock(mysql))
-    goto err;
+  if (opt_lock_all_tables || (opt_master_data && !consistent_binlog_pos) ||
+      (opt_single_transaction && flush_logs))
+  {
+    if (do_flush_tables_read_lock(mysql))
+      goto err;
+  }
+  else if (opt_single_transaction && opt_parallel)
+  {
+    /*
+      With --parallel every pool connection starts its own transaction.
+      Hold the global read lock while they start, so that all of them see
+      the same snapshot. This requires the RELOAD privilege; without it,
+      each table is still dumped consistently, but tables dumped by
+      different connections may come from different points in time.
+    */
+    if (mysql_query(mysql, "FLUSH /*!40101 LOCAL */ TABLES") ||
+        mysql_query(mysql, "FLUSH TABLES WITH READ LOCK"))
+    {
+      if (mysql_errno(mysql) != ER_SPECIFIC_ACCESS_DENIED_ERROR)
+      {
+        DB_error(mysql, "when locking tables for a parallel dump");
+        goto err;
+      }
+      fprintf(stderr, "-- Warning: %s; the parallel connections will not "
+              "share one snapshot\n", mysql_error(mysql));
+    }
+  }
 
   /*
     Flush logs before starting transaction since
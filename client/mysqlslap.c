@@ -84,6 +84,7 @@
 #include "client_priv.h"
 #include <mysqld_error.h>
 #include <my_dir.h>
+#include <my_bit.h>
 #include <signal.h>
 #include <sslopt-vars.h>
 #ifndef _WIN32
@@ -129,6 +130,7 @@ const char *create_schema_string= "mysqlslap";
 static my_bool opt_preserve= TRUE, opt_no_drop= FALSE;
 static my_bool debug_info_flag= 0, debug_check_flag= 0;
 static my_bool opt_only_print= FALSE;
+static my_bool opt_latency= FALSE;
 static my_bool opt_compress= FALSE, tty_password= FALSE,
                opt_silent= FALSE,
                auto_generate_sql_autoincrement= FALSE,
@@ -229,6 +231,55 @@ struct conclusions {
   unsigned long long min_rows;
 };
 
+/*
+  Per-query latency histogram in microseconds. Values below
+  LATENCY_SUB_BUCKETS have a bucket each, larger ones are bucketed
+  log-linearly with LATENCY_SUB_BUCKETS buckets per power of two,
+  so every bucket is accurate to about 6%.
+*/
+#define LATENCY_SUB_BITS 4
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+#define LATENCY_BUCKETS (LATENCY_SUB_BUCKETS * 40)
+static ulonglong latency_histogram[LATENCY_BUCKETS];
+
+static uint latency_bucket(ulonglong usec)
+{
+  uint e, idx;
+  if (usec < LATENCY_SUB_BUCKETS)
+    return (uint) usec;
+  e= my_bit_log2_uint64(usec);
+  idx= (e - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS +
+       (uint) ((usec >> (e - LATENCY_SUB_BITS)) & (LATENCY_SUB_BUCKETS - 1));
+  return MY_MIN(idx, LATENCY_BUCKETS - 1);
+}
+
+/* The smallest latency that falls into the bucket */
+static ulonglong latency_bucket_value(uint idx)
+{
+  uint e, sub;
+  if (idx < LATENCY_SUB_BUCKETS)
+    return idx;
+  e= idx / LATENCY_SUB_BUCKETS + LATENCY_SUB_BITS - 1;
+  sub= idx % LATENCY_SUB_BUCKETS;
+  return (ulonglong) (LATENCY_SUB_BUCKETS + sub) << (e - LATENCY_SUB_BITS);
+}
+
+/* The latency below which the given permille of the queries completed */
+static ulonglong latency_percentile(uint permille)
+{
+  ulonglong total= 0, seen= 0, target;
+  uint i;
+  for (i= 0; i < LATENCY_BUCKETS; i++)
+    total+= latency_histogram[i];
+  if (!total)
+    return 0;
+  target= (total * permille + 999) / 1000;
+  for (i= 0; i < LATENCY_BUCKETS; i++)
+    if ((seen+= latency_histogram[i]) >= target)
+      break;
+  return latency_bucket_value(i);
+}
+
 static option_string *engine_options= NULL;
 static statement *pre_statements= NULL; 
 static statement *post_statements= NULL; 
@@ -434,6 +485,7 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr)
                    sizeof(stats) * iterations, MYF(MY_ZEROFILL|MY_FAE|MY_WME));
 
   bzero(&conclusion, sizeof(conclusions));
+  bzero(latency_histogram, sizeof(latency_histogram));
 
   if (auto_actual_queries)
     client_limit= auto_actual_queries;
@@ -624,6 +676,10 @@ static struct my_option my_long_options[] =
    GET_STR, REQUIRED_ARG, 0, 0, 0, 0, 0, 0},
   {"iterations", 'i', "Number of times to run the tests.", &iterations,
     &iterations, 0, GET_UINT, REQUIRED_ARG, 1, 0, 0, 0, 0, 0},
+  {"latency-percentiles", 0,
+   "Report the 50th, 99th and 99.9th percentile of the latency of the "
+   "individual queries.",
+   &opt_latency, &opt_latency, 0, GET_BOOL, NO_ARG, 0, 0, 0, 0, 0, 0},
   {"no-drop", 0, "Do not drop the schema after the test.",
    &opt_no_drop, &opt_no_drop, 0, GET_BOOL, NO_ARG, 0, 0, 0, 0, 0, 0},
   {"number-char-cols", 'x', 
@@ -1861,6 +1917,8 @@ pthread_handler_t run_task(void *p)
   MYSQL_RES *result;
   statement *ptr;
   thread_context *con= (thread_context *)p;
+  ulonglong latency[LATENCY_BUCKETS];
+  ulonglong query_start= 0;
 
   DBUG_ENTER("run_task");
   DBUG_PRINT("info", ("task script \"%s\"", con->stmt ? con->stmt->string : ""));
@@ -1899,6 +1957,7 @@ pthread_handler_t run_task(void *p)
   if (verbose >= 3)
     printf("connected!\n");
   queries= 0;
+  bzero(latency, sizeof(latency));
 
   commit_counter= 0;
   if (commit_rate)
@@ -1923,6 +1982,9 @@ pthread_handler_t run_task(void *p)
           goto end;
       }
 
+      if (opt_latency)
+        query_start= microsecond_interval_timer();
+
       /* 
         We have to execute differently based on query type. This should become a function.
       */
@@ -1985,6 +2047,8 @@ pthread_handler_t run_task(void *p)
         }
       } while(mysql_next_result(mysql) == 0);
       queries++;
+      if (opt_latency)
+        latency[latency_bucket(microsecond_interval_timer() - query_start)]++;
 
       if (commit_rate && (++commit_counter == commit_rate))
       {
@@ -2008,6 +2072,12 @@ pthread_handler_t run_task(void *p)
   mysql_thread_end();
 
   pthread_mutex_lock(&counter_mutex);
+  if (opt_latency)
+  {
+    uint i;
+    for (i= 0; i < LATENCY_BUCKETS; i++)
+      latency_histogram[i]+= latency[i];
+  }
   thread_counter--;
   pthread_cond_signal(&count_threshhold);
   pthread_mutex_unlock(&counter_mutex);
@@ -2198,6 +2268,15 @@ print_conclusions(conclusions *con)
                     con->max_timing / 1000, con->max_timing % 1000);
   printf("\tNumber of clients running queries: %d\n", con->users);
   printf("\tAverage number of queries per client: %llu\n", con->avg_rows); 
+  if (opt_latency)
+  {
+    ulonglong p50= latency_percentile(500), p99= latency_percentile(990),
+              p999= latency_percentile(999);
+    printf("\tQuery latency 50th/99th/99.9th percentile: "
+           "%llu.%03llu/%llu.%03llu/%llu.%03llu ms\n",
+           p50 / 1000, p50 % 1000, p99 / 1000, p99 % 1000,
+           p999 / 1000, p999 % 1000);
+  }
   printf("\n");
 }
 
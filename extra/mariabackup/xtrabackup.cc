@@ -1379,6 +1379,7 @@ enum options_xtrabackup
   OPT_INNODB_FILE_PER_TABLE,
   OPT_INNODB_FLUSH_METHOD,
   OPT_INNODB_LOG_GROUP_HOME_DIR,
+  OPT_INNODB_LOG_ARCHIVE_DIR,
   OPT_INNODB_MAX_DIRTY_PAGES_PCT,
   OPT_INNODB_MAX_PURGE_LAG,
   OPT_INNODB_STATUS_FILE,
@@ -1991,6 +1992,11 @@ struct my_option xb_server_options[] =
   {"innodb_log_group_home_dir", OPT_INNODB_LOG_GROUP_HOME_DIR,
    "Path to InnoDB log files.", &srv_log_group_home_dir,
    &srv_log_group_home_dir, 0, GET_STR, REQUIRED_ARG, 0, 0, 0, 0, 0, 0},
+  {"innodb_log_archive_dir", OPT_INNODB_LOG_ARCHIVE_DIR,
+   "Path to the innodb_log_archive_dir of the server; during --backup,"
+   " the log will be copied from there when available.",
+   &srv_log_archive_dir, &srv_log_archive_dir, 0, GET_STR, REQUIRED_ARG,
+   0, 0, 0, 0, 0, 0},
   {"innodb_log_write_ahead_size", OPT_INNODB_LOG_WRITE_AHEAD_SIZE,
    "ib_logfile0 write size",
    (G_PTR*) &log_sys.write_size, (G_PTR*) &srv_log_file_size, 0,
@@ -2574,6 +2580,13 @@ static bool innodb_init_param()
 		goto error;
 	}
 
+	if (!xtrabackup_backup || (srv_log_archive_dir
+				   && !*srv_log_archive_dir)) {
+		srv_log_archive_dir = NULL;
+	} else if (srv_log_archive_dir) {
+		msg("innodb_log_archive_dir = %s", srv_log_archive_dir);
+	}
+
 	srv_adaptive_flushing = FALSE;
 
 	buf_pool.size_in_bytes_max = size_t(xtrabackup_use_memory);
@@ -3513,6 +3526,76 @@ static bool xtrabackup_copy_mmap_logfile()
   return false;
 }
 
+/** Read a chunk of the circular ib_logfile0 or innodb_log_archive_dir.
+@param lsn  log sequence number, aligned to log_sys.write_size
+@param buf  buffer of log_sys.buf_size bytes
+@return number of bytes read */
+static size_t backup_log_read(lsn_t lsn, byte *buf)
+{
+  /* The archive will not be overwritten by the server. */
+  if (srv_log_archive_dir)
+    if (size_t size= log_archive_read(lsn, buf, log_sys.buf_size))
+    {
+      static std::atomic<bool> reported;
+      if (!reported.exchange(true, std::memory_order_relaxed))
+        msg("Reading the redo log from innodb_log_archive_dir at LSN "
+            LSN_PF, lsn);
+      return size;
+    }
+  const os_offset_t source_offset{log_sys.calc_lsn_offset(lsn)};
+  size_t size{log_sys.buf_size};
+  if (UNIV_UNLIKELY(source_offset + size > log_sys.file_size))
+  {
+    const size_t first{size_t(log_sys.file_size - source_offset)};
+    ut_ad(first <= log_sys.buf_size);
+    log_sys.log.read(source_offset, {buf, first});
+    size-= first;
+    if (log_sys.START_OFFSET + size > source_offset)
+      size= size_t(source_offset - log_sys.START_OFFSET);
+    if (size)
+      log_sys.log.read(log_sys.START_OFFSET, {buf + first, size});
+    size+= first;
+  }
+  else
+    log_sys.log.read(source_offset, {buf, size});
+  return size;
+}
+
+/** Read-ahead of ib_logfile0 into log_sys.flush_buf, which is not
+otherwise used by the backup. The next chunk is read while the
+current one is being written to the backup, or while throttled. */
+static class log_read_ahead_t
+{
+  /** the reading thread */
+  std::thread thread;
+  /** the log sequence number that is being read */
+  lsn_t lsn;
+  /** the number of bytes that were read */
+  size_t size;
+public:
+  /** Start reading a chunk of ib_logfile0.
+  @param start_lsn  log sequence number, aligned to log_sys.write_size */
+  void start(lsn_t start_lsn)
+  {
+    ut_ad(!thread.joinable());
+    lsn= start_lsn;
+    byte *const buf{log_sys.flush_buf};
+    thread= std::thread([this, buf]{ size= backup_log_read(lsn, buf); });
+  }
+
+  /** Wait for any pending read-ahead.
+  @param start_lsn  the log sequence number that is needed next
+  @return the number of bytes available in log_sys.flush_buf
+  @retval 0 if the log sequence number was not read ahead */
+  size_t wait(lsn_t start_lsn= 0)
+  {
+    if (!thread.joinable())
+      return 0;
+    thread.join();
+    return start_lsn == lsn ? size : 0;
+  }
+} log_read_ahead;
+
 /** Copy redo log until the current end of the log is reached
 @param early_exit parse and copy only logs from first read and return
 @return whether the operation failed */
@@ -3541,26 +3624,14 @@ static bool xtrabackup_copy_logfile(bool early_exit)
     {
       recv_sys.len= 0;
       {
-        auto source_offset=
-          log_sys.calc_lsn_offset(recv_sys.lsn - recv_sys.offset);
-        source_offset&= ~block_size_1;
-        size_t size{log_sys.buf_size};
-        if (UNIV_UNLIKELY(source_offset + size > log_sys.file_size))
+        const lsn_t start_lsn{recv_sys.lsn - recv_sys.offset};
+        if (size_t size= log_read_ahead.wait(start_lsn))
         {
-          const size_t first{size_t(log_sys.file_size - source_offset)};
-          ut_ad(first <= log_sys.buf_size);
-          log_sys.log.read(source_offset, {log_sys.buf, first});
-          size-= first;
-          if (log_sys.START_OFFSET + size > source_offset)
-            size= size_t(source_offset - log_sys.START_OFFSET);
-          if (size)
-            log_sys.log.read(log_sys.START_OFFSET,
-                             {log_sys.buf + first, size});
-          size+= first;
+          std::swap(log_sys.buf, log_sys.flush_buf);
+          recv_sys.len= size;
         }
         else
-          log_sys.log.read(source_offset, {log_sys.buf, size});
-        recv_sys.len= size;
+          recv_sys.len= backup_log_read(start_lsn, log_sys.buf);
       }
 
       if (log_sys.buf[recv_sys.offset] <= 1)
@@ -3578,21 +3649,30 @@ static bool xtrabackup_copy_logfile(bool early_exit)
         }
         while ((r= backup_log_parse(false)) == recv_sys_t::OK);
 
+        /* If the current chunk ended in the middle of a mini-transaction,
+        read the next chunk while writing this one. */
+        const bool read_ahead{r == recv_sys_t::PREMATURE_EOF &&
+                              !early_exit &&
+                              recv_sys.offset >= log_sys.write_size};
+        if (read_ahead)
+          log_read_ahead.start(recv_sys.lsn -
+                               (recv_sys.offset & block_size_1));
+
         if (ds_write(dst_log_file, log_sys.buf + start_offset,
                      recv_sys.offset - start_offset))
         {
           msg("Error: write to ib_logfile0 failed");
+          log_read_ahead.wait();
           return true;
         }
         pthread_cond_broadcast(&scanned_lsn_cond);
 
-        if (r == recv_sys_t::GOT_EOF || early_exit)
-          break;
-
-        ut_ad(r == recv_sys_t::PREMATURE_EOF);
-
-        if (recv_sys.offset < log_sys.write_size)
+        if (!read_ahead)
+        {
+          ut_ad(r == recv_sys_t::GOT_EOF || early_exit ||
+                recv_sys.offset < log_sys.write_size);
           break;
+        }
 
         if (xtrabackup_throttle && io_ticket-- < 0)
           mysql_cond_wait(&wait_throttle, &recv_sys.mutex);
@@ -698,6 +698,7 @@ struct st_my_thread_var
   mysql_cond_t * volatile current_cond;
   void *keycache_link;
   void *keycache_file;
+  void *compress_stream; /* deflate state reused by my_compress_buffer() */
   void *stack_ends_here;
   safe_mutex_t *mutex_in_use;
   pthread_t pthread_self;
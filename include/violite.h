@@ -94,6 +94,11 @@ my_bool vio_reset(Vio* vio, enum enum_vio_type type,
 size_t	vio_read(Vio *vio, uchar *	buf, size_t size);
 size_t  vio_read_buff(Vio *vio, uchar * buf, size_t size);
 size_t	vio_write(Vio *vio, const uchar * buf, size_t size);
+#ifndef _WIN32
+#define HAVE_VIO_WRITEV
+/* Gathering write to a plain (not SSL) socket, see vio_write() */
+size_t	vio_writev(Vio *vio, const struct iovec *iov, int iovcnt);
+#endif
 int	vio_blocking(Vio *vio, my_bool onoff, my_bool *old_mode);
 my_bool	vio_is_blocking(Vio *vio);
 /* setsockopt TCP_NODELAY at IPPROTO_TCP level, when possible */
@@ -58,3 +58,93 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+/*
+  MSD radixsort for pointers to fixed length strings.
+  Unlike radixsort_for_str_ptr(), this does not need a pass over all
+  elements for each byte of the string: after the elements have been
+  distributed by the first distinguishing byte, each bucket is sorted
+  separately, and small buckets are sorted by comparison. This keeps the
+  accesses local for large numbers of elements.
+*/
+
+/* Buckets with fewer elements than this are sorted by my_qsort2() */
+#define RADIX_MSD_CUTOFF 64
+
+my_bool radixsort_msd_is_applicable(size_t n_items, size_t size_of_element)
+{
+  return size_of_element <= 64 && n_items >= 100000 && n_items <= UINT_MAX32;
+}
+
+static int cmp_str_ptr_suffix(void *arg, const void *a, const void *b)
+{
+  const size_t *range= (const size_t*) arg;  /* { offset, length } */
+  return memcmp(*(const uchar* const*) a + range[0],
+                *(const uchar* const*) b + range[0], range[1]);
+}
+
+/*
+  Distribute the elements by the byte at offset pass.
+  Returns 1 if all elements had the same byte, and nothing was moved.
+  Not inlined, so that count[] is not on the stack of each recursion level
+  of radixsort_msd().
+*/
+static ATTRIBUTE_NOINLINE my_bool radix_distribute(uchar **base, size_t n, size_t pass,
+                                uchar **buffer)
+{
+  uchar **ptr, **end= base + n;
+  size_t count[256], i, sum;
+
+  bzero((uchar*) count, sizeof count);
+  for (ptr= base; ptr < end; ptr++)
+    count[ptr[0][pass]]++;
+  for (i= 0, sum= 0; i < 256; i++)
+  {
+    size_t c= count[i];
+    if (c == n)
+      return 1;
+    count[i]= sum;
+    sum+= c;
+  }
+  for (ptr= base; ptr < end; ptr++)
+    buffer[count[ptr[0][pass]]++]= *ptr;
+  memcpy(base, buffer, n * sizeof *base);
+  return 0;
+}
+
+static void radixsort_msd(uchar **base, size_t n, size_t size, size_t pass,
+                          uchar **buffer)
+{
+  size_t i, j;
+
+  for (;; pass++)
+  {
+    if (pass == size)
+      return;                                   /* All are equal */
+    if (n < RADIX_MSD_CUTOFF)
+    {
+      size_t range[2];
+      range[0]= pass;
+      range[1]= size - pass;
+      my_qsort2(base, n, sizeof *base, cmp_str_ptr_suffix, range);
+      return;
+    }
+    if (!radix_distribute(base, n, pass, buffer))
+      break;
+  }
+
+  /* Sort each bucket by the following bytes. */
+  for (i= 0; i < n; i= j)
+  {
+    const uchar b= base[i][pass];
+    for (j= i + 1; j < n && base[j][pass] == b; j++) {}
+    if (j - i > 1)
+      radixsort_msd(base + i, j - i, size, pass + 1, buffer);
+  }
+}
+
+void radixsort_msd_for_str_ptr(uchar **base, size_t number_of_elements,
+                               size_t size_of_element, uchar **buffer)
+{
+  radixsort_msd(base, number_of_elements, size_of_element, 0, buffer);
+}
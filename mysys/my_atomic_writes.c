@@ -24,6 +24,9 @@ my_bool has_shannon_atomic_write, has_fusion_io_atomic_write,
 my_bool has_sfx_card;
 
 #include <sys/ioctl.h>
+#include <sys/stat.h> /* statx() */
+#include <sys/uio.h> /* RWF_ATOMIC */
+#include <fcntl.h> /* AT_EMPTY_PATH */
 
 /* Linux seems to allow up to 15 partitions per block device.
 Partition number 0 is the whole block device. */
@@ -490,6 +493,35 @@ my_bool my_test_if_atomic_write(File handle, int page_size)
 }
 
 
+/**
+  Check if a file supports torn-write-safe writes of a page
+  by means of pwritev2(RWF_ATOMIC).
+
+  @param handle     file handle (opened with O_DIRECT)
+  @param page_size  size of each write
+
+  @return FALSE   No support, or writes of page_size would be split
+          TRUE    Writes of page_size with RWF_ATOMIC are atomic
+*/
+
+my_bool my_test_if_rwf_atomic(File handle, int page_size)
+{
+#if defined RWF_ATOMIC && defined STATX_WRITE_ATOMIC
+  struct statx stx;
+  if (statx(handle, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &stx) ||
+      !(stx.stx_mask & STATX_WRITE_ATOMIC) ||
+      !(stx.stx_attributes & STATX_ATTR_WRITE_ATOMIC))
+    return 0;
+  return stx.stx_atomic_write_unit_min <= (unsigned) page_size &&
+    stx.stx_atomic_write_unit_max >= (unsigned) page_size;
+#else
+  (void) handle;
+  (void) page_size;
+  return 0;
+#endif
+}
+
+
 /**
   Check if a file resides on thinly provisioned storage.
 
@@ -70,6 +70,69 @@ void my_az_free(void *dummy __attribute__((unused)), void *address)
   my_free(address);
 }
 
+/*
+  Like my_az_allocator(), but the memory is accounted to the current
+  session (Memory_used), like other per-connection buffers.
+*/
+static void *my_az_thread_allocator(void *dummy __attribute__((unused)),
+                                    unsigned int items, unsigned int size)
+{
+  return my_malloc(key_memory_my_compress_alloc, (size_t)items*(size_t)size,
+                   MYF(MY_THREAD_SPECIFIC));
+}
+
+/*
+  Return the deflate state of the current thread, creating it if needed.
+  Reusing it with deflateReset() avoids allocating and initializing the
+  compression state (a few hundred KB) for every packet. The server frees
+  it with my_compress_free_state() when the connection becomes idle.
+*/
+static z_stream *my_thread_compress_stream(void)
+{
+  struct st_my_thread_var *thread_var= my_thread_var;
+  z_stream *stream;
+
+  if (!thread_var)
+    return 0;
+  if ((stream= (z_stream*) thread_var->compress_stream))
+    return deflateReset(stream) == Z_OK ? stream : 0;
+
+  if (!(stream= (z_stream*) my_malloc(key_memory_my_compress_alloc,
+                                      sizeof(*stream),
+                                      MYF(MY_THREAD_SPECIFIC))))
+    return 0;
+  stream->zalloc= (alloc_func)my_az_thread_allocator;
+  stream->zfree= (free_func)my_az_free;
+  stream->opaque= (voidpf)0;
+  if (deflateInit(stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+  {
+    my_free(stream);
+    return 0;
+  }
+  thread_var->compress_stream= stream;
+  return stream;
+}
+
+
+/* Free the deflate state of a thread, called by my_thread_end() */
+void my_compress_thread_end(struct st_my_thread_var *thread_var)
+{
+  z_stream *stream= (z_stream*) thread_var->compress_stream;
+  deflateEnd(stream);
+  my_free(stream);
+  thread_var->compress_stream= 0;
+}
+
+
+/* Free the deflate state of the current thread, if there is one */
+void my_compress_free_state(void)
+{
+  struct st_my_thread_var *thread_var= my_thread_var;
+  if (thread_var && thread_var->compress_stream)
+    my_compress_thread_end(thread_var);
+}
+
+
 /*
   This works like zlib compress(), but using custom memory allocators to work
   better with my_malloc leak detection and Valgrind.
@@ -77,15 +140,30 @@ void my_az_free(void *dummy __attribute__((unused)), void *address)
 int my_compress_buffer(uchar *dest, size_t *destLen,
                        const uchar *source, size_t sourceLen)
 {
-    z_stream stream;
+    z_stream stream, *thread_stream;
     int err;
 
+    if ((uInt)*destLen != *destLen)
+      return Z_BUF_ERROR;
+
+    if ((thread_stream= my_thread_compress_stream()))
+    {
+      thread_stream->next_in = (Bytef*)source;
+      thread_stream->avail_in = (uInt)sourceLen;
+      thread_stream->next_out = (Bytef*)dest;
+      thread_stream->avail_out = (uInt)*destLen;
+
+      err = deflate(thread_stream, Z_FINISH);
+      if (err != Z_STREAM_END)
+        return err == Z_OK ? Z_BUF_ERROR : err;
+      *destLen = thread_stream->total_out;
+      return Z_OK;
+    }
+
     stream.next_in = (Bytef*)source;
     stream.avail_in = (uInt)sourceLen;
     stream.next_out = (Bytef*)dest;
     stream.avail_out = (uInt)*destLen;
-    if ((size_t)stream.avail_out != *destLen)
-      return Z_BUF_ERROR;
 
     stream.zalloc = (alloc_func)my_az_allocator;
     stream.zfree = (free_func)my_az_free;
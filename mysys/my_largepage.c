@@ -403,6 +403,17 @@ uchar *my_large_malloc(size_t *size, myf my_flags)
         */
         *size= aligned_size;
       }
+#ifdef MADV_HUGEPAGE
+      else if (my_use_large_pages)
+      {
+        /*
+          No HugeTLB page size was available for this size. Let the
+          kernel back the mapping with transparent huge pages instead,
+          as far as it is aligned.
+        */
+        madvise(ptr, aligned_size, MADV_HUGEPAGE);
+      }
+#endif
       break;
     }
     if (large_page_size == 0)
@@ -428,12 +439,21 @@ uchar *my_large_malloc(size_t *size, myf my_flags)
   Special large pages allocator, with possibility to commit to allocating
   more memory later.
   Every implementation returns a zero filled buffer here.
+
+  @param size       requested size; adjusted to the size of the mapping
+  @param page_size  set to the large page size if the mapping was not
+                    populated and the caller must invoke
+                    my_large_virtual_commit() on aligned ranges before
+                    accessing them; set to 0 if the whole mapping is
+                    accessible
 */
-char *my_large_virtual_alloc(size_t *size)
+char *my_large_virtual_alloc(size_t *size, size_t *page_size)
 {
   char *ptr;
   DBUG_ENTER("my_large_virtual_alloc");
 
+  *page_size= 0;
+
   if (my_use_large_pages)
   {
     size_t large_page_size;
@@ -441,7 +461,45 @@ char *my_large_virtual_alloc(size_t *size)
 
     while ((large_page_size= my_next_large_page_size(*size, &page_i)) != 0)
     {
-      int mapflag= MAP_PRIVATE |
+      size_t aligned_size= MY_ALIGN(*size, (size_t) large_page_size);
+      int mapflag;
+# if defined MAP_HUGETLB && defined MAP_NORESERVE && defined MADV_POPULATE_WRITE
+      /*
+        Reserve the address range without populating it, so that the
+        caller can commit huge pages on demand (Linux 5.14+). If the
+        kernel does not support MADV_POPULATE_WRITE, fall back to
+        populating the entire mapping at once.
+      */
+      ptr= mmap(NULL, aligned_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_NORESERVE | MAP_HUGETLB |
+#  if defined MAP_HUGE_SHIFT
+                my_bit_log2_size_t(large_page_size) << MAP_HUGE_SHIFT |
+#  endif
+                OS_MAP_ANON, -1, 0);
+      if (ptr != (void*) -1)
+      {
+        int err;
+        if (!madvise(ptr, large_page_size, MADV_POPULATE_WRITE))
+        {
+          /* Leave everything but the first page unpopulated. */
+          madvise(ptr, large_page_size, MADV_DONTNEED);
+          if (!mprotect(ptr, aligned_size, PROT_NONE))
+          {
+            *size= aligned_size;
+            *page_size= large_page_size;
+            DBUG_RETURN(ptr);
+          }
+        }
+        err= errno;
+        munmap(ptr, aligned_size);
+        /* try next smaller memory size */
+        if (err == ENOMEM || err == EFAULT)
+          continue;
+      }
+      else if (errno == ENOMEM)
+        continue;
+# endif
+      mapflag= MAP_PRIVATE |
 # ifdef MAP_POPULATE
         MAP_POPULATE |
 # endif
@@ -460,7 +518,6 @@ char *my_large_virtual_alloc(size_t *size)
 # endif
         OS_MAP_ANON;
 
-      size_t aligned_size= MY_ALIGN(*size, (size_t) large_page_size);
       ptr= mmap(NULL, aligned_size, PROT_READ | PROT_WRITE, mapflag, -1, 0);
       if (ptr == (void*) -1)
       {
@@ -318,6 +318,11 @@ void my_thread_end(void)
 	  tmp, pthread_self(), tmp ? (long) tmp->id : 0L);
 #endif  
 
+#ifdef HAVE_COMPRESS
+  if (tmp && tmp->compress_stream)
+    my_compress_thread_end(tmp);
+#endif
+
   /*
     Remove the instrumentation for this thread.
     This must be done before trashing st_my_thread_var,
@@ -124,6 +124,44 @@ char *my_virtual_mem_commit(char *ptr, size_t size)
   return ptr;
 }
 
+#ifndef _WIN32
+/**
+  Commit memory in a range that my_large_virtual_alloc() reserved
+  with a nonzero page_size.
+  @param ptr   start of the range, aligned to the large page size
+  @param size  size of the range, a multiple of the large page size
+  @return ptr
+  @retval NULL if the large pages could not be allocated
+*/
+char *my_large_virtual_commit(char *ptr, size_t size)
+{
+  DBUG_ASSERT(ptr);
+  DBUG_ASSERT(my_use_large_pages);
+# ifdef MADV_POPULATE_WRITE
+  if (mprotect(ptr, size, PROT_READ | PROT_WRITE))
+  {
+    my_error(EE_OUTOFMEMORY, MYF(ME_BELL + ME_ERROR_LOG), size);
+    return NULL;
+  }
+  /*
+    Populate the mapping now, so that running out of huge pages will
+    result in an error here instead of SIGBUS on a later access.
+  */
+  if (madvise(ptr, size, MADV_POPULATE_WRITE))
+  {
+    madvise(ptr, size, MADV_DONTNEED);
+    mprotect(ptr, size, PROT_NONE);
+    my_error(EE_OUTOFMEMORY, MYF(ME_BELL + ME_ERROR_LOG), size);
+    return NULL;
+  }
+# else
+  DBUG_ASSERT(0); /* my_large_virtual_alloc() never returns page_size!=0 */
+# endif
+  update_malloc_size(size, 0);
+  return ptr;
+}
+#endif
+
 void my_virtual_mem_decommit(char *ptr, size_t size)
 {
 #ifdef _WIN32
@@ -133,6 +133,7 @@ size_t sf_malloc_usable_size(void *ptr, my_bool *is_thread_specific);
 #endif
 
 void my_error_unregister_all(void);
+void my_compress_thread_end(struct st_my_thread_var *thread_var);
 
 #ifndef O_PATH        /* not Linux */
 #if defined(O_SEARCH) /* Illumos */
@@ -308,6 +308,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
   param.sort_keys= sort_keys;
   sort_len= sortlength(thd, sort_keys, &allow_packing_for_sortkeys);
   param.init_for_filesort(table, filesort, sort_len, limit_rows);
+  param.max_sort_threads= thd->variables.sort_threads;
   if (!param.accepted_rows)
     param.accepted_rows= &not_used;
 
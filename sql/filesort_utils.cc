@@ -20,6 +20,11 @@
 #include "sql_sort.h"
 #include "table.h"
 #include "optimizer_defaults.h"
+#include "mysqld.h"
+#include <tpool.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
 
@@ -383,6 +388,219 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+/*
+  Minimum number of keys for each thread of sort_keys_parallel().
+  Below this, the cost of submitting a task exceeds the gain.
+*/
+static constexpr uint SORT_KEYS_PER_THREAD= 16384;
+
+/** The worker threads of sort_keys_parallel(), created on first use */
+static tpool::thread_pool *sort_thread_pool;
+static std::once_flag sort_thread_pool_created;
+
+static void sort_thread_pool_thread_init()
+{
+  my_thread_init();
+  PSI_thread *psi __attribute__((unused))=
+    PSI_CALL_new_thread(key_thread_filesort, NULL, 0);
+  PSI_CALL_set_thread_os_id(psi);
+  PSI_CALL_set_thread(psi);
+  my_thread_set_name("filesort_worker");
+}
+
+static void sort_thread_pool_thread_end()
+{
+  PSI_CALL_delete_current_thread();
+  my_thread_end();
+}
+
+static void sort_thread_pool_create()
+{
+#ifdef _WIN32
+  sort_thread_pool= tpool::create_thread_pool_win();
+#else
+  sort_thread_pool= tpool::create_thread_pool_generic();
+#endif
+  sort_thread_pool->set_thread_callbacks(sort_thread_pool_thread_init,
+                                         sort_thread_pool_thread_end);
+}
+
+void filesort_thread_pool_end()
+{
+  delete sort_thread_pool;
+  sort_thread_pool= nullptr;
+}
+
+
+/**
+  Merge two adjacent sorted ranges of key pointers.
+
+  @param src      the sorted ranges [lo,mid) and [mid,hi)
+  @param dst      where to write the merged range [lo,hi)
+  @param lo       start of the first range
+  @param mid      end of the first range and start of the second range
+  @param hi       end of the second range
+  @param cmp      comparison function
+  @param cmp_arg  argument of cmp
+
+  Of equal keys, the one from the first range is written first.
+*/
+
+static void merge_sort_keys(uchar **src, uchar **dst,
+                            size_t lo, size_t mid, size_t hi,
+                            qsort_cmp2 cmp, void *cmp_arg)
+{
+  size_t i= lo, j= mid, k= lo;
+  while (i < mid && j < hi)
+    dst[k++]= cmp(cmp_arg, &src[j], &src[i]) < 0 ? src[j++] : src[i++];
+  while (i < mid)
+    dst[k++]= src[i++];
+  while (j < hi)
+    dst[k++]= src[j++];
+}
+
+
+/** A slice of the work of sort_keys_parallel() */
+struct Sort_keys_job
+{
+  tpool::waitable_task task;
+  /** the keys */
+  uchar **src;
+  /** nullptr to sort src[lo,hi); else where to merge src[lo,mid),[mid,hi) */
+  uchar **dst;
+  size_t lo, mid, hi;
+  qsort_cmp2 cmp;
+  void *cmp_arg;
+
+  Sort_keys_job() : task(run, this) {}
+
+  static void run(void *arg)
+  {
+    Sort_keys_job *job= static_cast<Sort_keys_job*>(arg);
+    if (job->dst)
+      merge_sort_keys(job->src, job->dst, job->lo, job->mid, job->hi,
+                      job->cmp, job->cmp_arg);
+    else
+      my_qsort2(job->src + job->lo, job->hi - job->lo, sizeof *job->src,
+                job->cmp, job->cmp_arg);
+  }
+};
+
+
+/**
+  Sort an array of key pointers by multiple threads.
+
+  The array is split into slices that are sorted concurrently by my_qsort2().
+  Then, adjacent pairs of slices are merged concurrently, until one sorted
+  range remains. The current thread processes the last slice of each pass;
+  the others are submitted as tasks to sort_thread_pool.
+
+  The comparison functions of Sort_param only read the keys and the
+  Sort_param, so they can be invoked by several threads at a time.
+
+  @param keys       the array to sort
+  @param count      number of elements in keys
+  @param n_threads  number of threads to use
+  @param cmp        comparison function
+  @param cmp_arg    argument of cmp
+
+  @retval false  on success
+  @retval true   if memory could not be allocated; the array must then be
+                 sorted by the caller
+*/
+
+static bool sort_keys_parallel(uchar **keys, size_t count, uint n_threads,
+                               qsort_cmp2 cmp, void *cmp_arg)
+{
+  uchar **tmp= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count * sizeof *keys,
+                                   MYF(MY_THREAD_SPECIFIC));
+  if (!tmp)
+    return true;
+
+  std::vector<size_t> bounds;
+  std::unique_ptr<Sort_keys_job[]> jobs;
+
+  try
+  {
+    std::call_once(sort_thread_pool_created, sort_thread_pool_create);
+    bounds.reserve(n_threads + 1);
+    jobs.reset(new Sort_keys_job[n_threads - 1]);
+  }
+  catch (...)
+  {
+    my_free(tmp);
+    return true;
+  }
+
+  for (uint i= 0; i <= n_threads; i++)
+    bounds.push_back(count * i / n_threads);
+
+  for (uint i= 1; i < n_threads; i++)
+  {
+    Sort_keys_job &job= jobs[i - 1];
+    job.src= keys;
+    job.dst= nullptr;
+    job.lo= bounds[i];
+    job.hi= bounds[i + 1];
+    job.cmp= cmp;
+    job.cmp_arg= cmp_arg;
+    sort_thread_pool->submit_task(&job.task);
+  }
+  my_qsort2(keys, bounds[1], sizeof *keys, cmp, cmp_arg);
+  for (uint i= 1; i < n_threads; i++)
+    jobs[i - 1].task.wait();
+
+  /*
+    Each pass halves the number of ranges, so that bounds can be
+    updated in place.
+  */
+  uchar **src= keys, **dst= tmp;
+  while (bounds.size() > 2)
+  {
+    size_t i= 0, n= 0;
+    for (; i + 2 < bounds.size(); i+= 2, n++)
+    {
+      if (i + 4 < bounds.size())
+      {
+        Sort_keys_job &job= jobs[n];
+        job.src= src;
+        job.dst= dst;
+        job.lo= bounds[i];
+        job.mid= bounds[i + 1];
+        job.hi= bounds[i + 2];
+        sort_thread_pool->submit_task(&job.task);
+      }
+      else
+        merge_sort_keys(src, dst, bounds[i], bounds[i + 1], bounds[i + 2],
+                        cmp, cmp_arg);
+    }
+
+    for (size_t j= 0; j + 1 < n; j++)
+      jobs[j].task.wait();
+
+    size_t merged= 0;
+    for (size_t j= 0; j < i; j+= 2)
+      bounds[merged++]= bounds[j];
+
+    if (i + 2 == bounds.size())
+    {
+      /* Copy the last range, which had no pair. */
+      bounds[merged++]= bounds[i];
+      memcpy(dst + bounds[i], src + bounds[i],
+             (bounds[i + 1] - bounds[i]) * sizeof *keys);
+    }
+    bounds[merged++]= count;
+    bounds.resize(merged);
+    std::swap(src, dst);
+  }
+
+  if (src != keys)
+    memcpy(keys, src, count * sizeof *keys);
+  my_free(tmp);
+  return false;
+}
+
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
@@ -395,17 +613,37 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
   if (!param->using_pq)
     reverse_record_pointers();
 
+  /*
+    Unpacked sort keys are memcmp() comparable. Short keys are sorted by
+    an LSD radix sort, which makes one pass over all of them per byte.
+    For more keys, an MSD radix sort has better locality.
+  */
   uchar **buffer= NULL;
-  if (!param->using_packed_sortkeys() &&
-      radixsort_is_applicable(count, param->sort_length) &&
-      (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
-                                   MYF(MY_THREAD_SPECIFIC))))
+  if (!param->using_packed_sortkeys())
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
-    my_free(buffer);
-    return;
+    const bool lsd= radixsort_is_applicable(count, param->sort_length);
+    if ((lsd || radixsort_msd_is_applicable(count, param->sort_length)) &&
+        (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
+                                     MYF(MY_THREAD_SPECIFIC))))
+    {
+      if (lsd)
+        radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+      else
+        radixsort_msd_for_str_ptr(m_sort_keys, count, param->sort_length,
+                                  buffer);
+      my_free(buffer);
+      return;
+    }
   }
 
+  const uint n_threads= MY_MIN(param->max_sort_threads,
+                               count / SORT_KEYS_PER_THREAD);
+  if (n_threads > 1 &&
+      !sort_keys_parallel(m_sort_keys, count, n_threads,
+                          param->get_compare_function(),
+                          param->get_compare_argument(&size)))
+    return;
+
   my_qsort2(m_sort_keys, count, sizeof(uchar*),
             param->get_compare_function(),
             param->get_compare_argument(&size));
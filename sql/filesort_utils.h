@@ -345,4 +345,7 @@ double get_qsort_sort_cost(ha_rows num_rows, bool with_addon_fields);
 int compare_packed_sort_keys(void *sort_param, const void *a_ptr,
                              const void *b_ptr);
 qsort_cmp2 get_packed_keys_compare_ptr();
+
+/** Shut down the worker threads of parallel sort_buffer() */
+void filesort_thread_pool_end();
 #endif  // FILESORT_UTILS_INCLUDED
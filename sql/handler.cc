@@ -3812,6 +3812,47 @@ int handler::ha_rnd_next(uchar *buf)
   DBUG_RETURN(result);
 }
 
+int handler::sample_next(uchar *buf, double fraction)
+{
+  THD *thd= table->in_use;
+  for (;;)
+  {
+    int result= rnd_next(buf);
+    if (!result)
+    {
+      if (thd_rnd(thd) <= fraction)
+        return 0;
+    }
+    else if (result != HA_ERR_RECORD_DELETED)
+      return result;
+    if (thd->check_killed(1))
+      return HA_ERR_ABORTED_BY_USER;
+  }
+}
+
+
+int handler::ha_sample_next(uchar *buf, double fraction)
+{
+  int result;
+  DBUG_ENTER("handler::ha_sample_next");
+  DBUG_ASSERT(table_share->tmp_table != NO_TMP_TABLE ||
+              m_lock_type != F_UNLCK);
+  DBUG_ASSERT(inited == RND);
+
+  TABLE_IO_WAIT(tracker, PSI_TABLE_FETCH_ROW, MAX_KEY, result,
+    { result= sample_next(buf, fraction); })
+  if (!result)
+  {
+    update_rows_read();
+    if (table->vfield && buf == table->record[0])
+      table->update_virtual_fields(this, VCOL_UPDATE_FOR_READ);
+  }
+  increment_statistics(&SSV::ha_read_rnd_next_count);
+  table->status=result ? STATUS_NOT_FOUND: 0;
+  DBUG_RETURN(result);
+}
+
+
 int handler::ha_rnd_pos(uchar *buf, uchar *pos)
 {
   int result;
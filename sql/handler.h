@@ -4376,6 +4376,25 @@ class handler :public Sql_alloc
   virtual int ft_read(uchar *buf) { return HA_ERR_WRONG_COMMAND; }
   virtual int rnd_next(uchar *buf)=0;
   virtual int rnd_pos(uchar * buf, uchar *pos)=0;
+  /**
+    Read the next row of a random sample of a table scan that was
+    initialized with ha_rnd_init(true).
+
+    The default implementation reads every row with rnd_next() and returns
+    each one with the probability fraction. An engine may instead return
+    consecutive rows from randomly chosen blocks, as long as it returns
+    about fraction of all rows of the table and no block more than once.
+
+    collect_statistics_for_table() treats the result as a Bernoulli sample.
+    A block sample is clustered: for a column that is correlated with the
+    physical order of the rows, values repeat within a block, and the
+    estimate of the number of distinct values will be too low.
+
+    @param buf       buffer for the row
+    @param fraction  fraction of the rows to return, between 0 and 1
+    @return 0, HA_ERR_END_OF_FILE or an error code
+  */
+  virtual int sample_next(uchar *buf, double fraction);
   /**
     This function only works for handlers having
     HA_PRIMARY_KEY_REQUIRED_FOR_POSITION set.
@@ -4403,6 +4422,7 @@ class handler :public Sql_alloc
   inline void ha_ft_end() { ft_end(); ft_handler=NULL; }
   int ha_rnd_next(uchar *buf);
   int ha_rnd_pos(uchar *buf, uchar *pos);
+  int ha_sample_next(uchar *buf, double fraction);
   inline int ha_rnd_pos_by_record(uchar *buf);
   inline int ha_read_first_row(uchar *buf, uint primary_key);
 
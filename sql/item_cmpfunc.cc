@@ -6178,7 +6178,19 @@ bool Item_func_like::fix_fields(THD *thd, Item **ref)
       {
         const char* tmp = first + 1;
         for (; *tmp != wild_many && *tmp != wild_one && *tmp != escape; tmp++) ;
-        canDoTurboBM = (tmp == last) && !args[0]->collation.collation->use_mb();
+        /*
+          A UTF-8 binary collation compares bytes, and a valid UTF-8
+          pattern can only match at a character boundary, so the byte
+          based search is correct for it too. The collation that LIKE
+          compares with may differ from that of args[0], for example
+          with an explicit COLLATE clause.
+        */
+        CHARSET_INFO *cs= cmp_collation.collation;
+        canDoTurboBM = (tmp == last) &&
+                       (!args[0]->collation.collation->use_mb() ||
+                        ((cs->state & MY_CS_BINSORT) &&
+                         (cs->state & MY_CS_UNICODE) &&
+                         cs->mbminlen == 1 && !cs->sort_order));
       }
       if (canDoTurboBM)
       {
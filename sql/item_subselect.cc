@@ -40,6 +40,8 @@
 #include "sql_test.h"
 #include "opt_trace.h"
 #include "my_json_writer.h"
+#include "key.h"                                // key_copy
+#include "bloom_filters.h"
 
 double get_post_group_estimate(JOIN* join, double join_op_rows);
 
@@ -3914,6 +3916,7 @@ bool subselect_union_engine::no_rows()
 void subselect_uniquesubquery_engine::cleanup()
 {
   DBUG_ENTER("subselect_uniquesubquery_engine::cleanup");
+  free_key_filter();
   /* 
     Note for mergers: we don't have to, and actually must not de-initialize
     tab->table->file here.
@@ -4398,6 +4401,21 @@ int subselect_uniquesubquery_engine::exec()
     DBUG_RETURN(0);
   }
 
+  if (key_filter)
+  {
+    uchar *probe[8];
+    probe[0]= (uchar*) (intptr) key_hash(tab->ref.key_buff);
+    for (uint i= 1; i < array_elements(probe); i++)
+      probe[i]= probe[0];
+    if (!(key_filter->Query(probe) & 1))
+    {
+      /* The index lookup would not find any row. */
+      table->status= STATUS_NOT_FOUND;
+      in_subs->value= 0;
+      DBUG_RETURN(0);
+    }
+  }
+
   if (!table->file->inited &&
       (error= table->file->ha_index_init(tab->ref.key, 0)))
   {
@@ -4471,8 +4489,112 @@ int subselect_uniquesubquery_engine::index_lookup()
 
 
 
+/**
+  Compute the value that represents a lookup key in key_filter.
+
+  @param key  key image of tab->ref.key_length bytes
+*/
+
+uint64 subselect_uniquesubquery_engine::key_hash(const uchar *key) const
+{
+  uint64 hash= 0;
+  if (tab->ref.key_length <= sizeof hash)
+    memcpy(&hash, key, tab->ref.key_length);
+  else
+    hash= my_crc32c(0, key, tab->ref.key_length);
+  return hash;
+}
+
+
+/**
+  Build a Bloom filter of the keys of a materialized subquery.
+
+  @details
+    The filter lets exec() skip the index lookup for most outer rows that
+    have no match. It is only built when the key image of equal values is
+    always the same, that is, when all key parts are NOT NULL integers, and
+    when the filter is small compared to max_heap_table_size.
+
+  @param n_keys  number of rows in the table
+
+  @retval FALSE  OK, the filter may or may not have been built
+  @retval TRUE   error reading the table
+*/
+
+bool subselect_uniquesubquery_engine::build_key_filter(ha_rows n_keys)
+{
+  TABLE *table= tab->table;
+  KEY *key_info= table->key_info + tab->ref.key;
+  int error;
+  DBUG_ENTER("subselect_uniquesubquery_engine::build_key_filter");
+  DBUG_ASSERT(!key_filter);
+
+  if (table->file->inited || !n_keys ||
+      n_keys > thd->variables.max_heap_table_size / 3)
+    DBUG_RETURN(FALSE);
+
+  for (uint i= 0; i < tab->ref.key_parts; i++)
+  {
+    const Field *field= key_info->key_part[i].field;
+    if (field->real_maybe_null())
+      DBUG_RETURN(FALSE);
+    switch (field->real_type()) {
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_INT24:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG:
+      break;
+    default:
+      DBUG_RETURN(FALSE);
+    }
+  }
+
+  uchar *key= (uchar*) thd->alloc(tab->ref.key_length);
+  if (!key || (error= table->file->ha_rnd_init(1)))
+    DBUG_RETURN(FALSE);
+
+  key_filter= new PatternedSimdBloomFilter<uchar>((int) n_keys, 0.01f);
+  const uchar *batch[8];
+  uint n= 0;
+  while (!(error= table->file->ha_rnd_next(table->record[0])))
+  {
+    key_copy(key, table->record[0], key_info, tab->ref.key_length);
+    batch[n++]= (const uchar*) (intptr) key_hash(key);
+    if (n == array_elements(batch))
+    {
+      key_filter->Insert(batch);
+      n= 0;
+    }
+  }
+  if (n)
+  {
+    for (uint i= n; i < array_elements(batch); i++)
+      batch[i]= batch[0];
+    key_filter->Insert(batch);
+  }
+  table->file->ha_rnd_end();
+
+  if (error != HA_ERR_END_OF_FILE)
+  {
+    free_key_filter();
+    (void) report_error(table, error);
+    DBUG_RETURN(TRUE);
+  }
+  DBUG_RETURN(FALSE);
+}
+
+
+void subselect_uniquesubquery_engine::free_key_filter()
+{
+  delete key_filter;
+  key_filter= NULL;
+}
+
+
 subselect_uniquesubquery_engine::~subselect_uniquesubquery_engine()
 {
+  free_key_filter();
   /* Tell handler we don't need the index anymore */
   //psergey-merge-todo: the following was gone in 6.0:
  //psergey-merge: don't need this after all: tab->table->file->ha_index_end();
@@ -5935,6 +6057,14 @@ int subselect_hash_sj_engine::exec()
     }
   }
 
+  if (strategy == COMPLETE_MATCH &&
+      ((subselect_uniquesubquery_engine*) lookup_engine)->
+        build_key_filter(tmp_table->file->stats.records))
+  {
+    res= 1;
+    goto err;
+  }
+
   if (pm_engine)
     lookup_engine= pm_engine;
   item_in->change_engine(lookup_engine);
@@ -1012,6 +1012,8 @@ struct st_join_table;
   functions, etc.
 */
 
+template <typename T> struct PatternedSimdBloomFilter;
+
 class subselect_uniquesubquery_engine: public subselect_engine
 {
 protected:
@@ -1022,12 +1024,18 @@ class subselect_uniquesubquery_engine: public subselect_engine
     expression is NULL.
   */
   bool empty_result_set;
+  /*
+    Bloom filter of the lookup keys of a materialized subquery, or NULL.
+    A key that is not in the filter cannot be found by the index lookup.
+  */
+  PatternedSimdBloomFilter<uchar> *key_filter;
+  uint64 key_hash(const uchar *key) const;
 public:
 
   // constructor can assign THD because it will be called after JOIN::prepare
   subselect_uniquesubquery_engine(THD *thd_arg, st_join_table *tab_arg,
 				  Item_in_subselect *subs, Item *where)
-    :subselect_engine(subs, 0), tab(tab_arg), cond(where)
+    :subselect_engine(subs, 0), tab(tab_arg), cond(where), key_filter(NULL)
   {
     thd= thd_arg;
     DBUG_ASSERT(subs);
@@ -1049,6 +1057,8 @@ class subselect_uniquesubquery_engine: public subselect_engine
   int index_lookup(); /* TIMOUR: this method needs refactoring. */
   int scan_table();
   bool copy_ref_key(bool skip_constants);
+  bool build_key_filter(ha_rows n_keys);
+  void free_key_filter();
   bool no_rows() override { return empty_result_set; }
   enum_engine_type engine_type() override { return UNIQUESUBQUERY_ENGINE; }
 };
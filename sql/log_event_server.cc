@@ -7522,7 +7522,8 @@ static int end_of_file_error(rpl_group_info *rgi)
 
   Note that one MUST call ha_index_or_rnd_end() after this function if
   it returns 0 as we must leave the row position in the handler intact
-  for any following update/delete command.
+  for any following update/delete command. A table scan may be left open
+  until do_after_row_operations(), so that the next row resumes it.
 */
 
 int Rows_log_event::find_row(rpl_group_info *rgi)
@@ -7746,8 +7747,18 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
     /* We use this to test that the correct key is used in test cases. */
     DBUG_EXECUTE_IF("slave_crash_if_table_scan", abort(););
 
-    /* We don't have a key: search the table using rnd_next() */
-    if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+    /*
+      We don't have a key: search the table using rnd_next().
+
+      The rows of an event usually come in the order in which the master
+      scanned the table, so the scan is not restarted for every row.
+      The scan is left open by do_exec_row() and resumed after the
+      previously found row. It only wraps around to the beginning of the
+      table if the end is reached.
+    */
+    bool from_start= table->file->inited != handler::RND;
+    if (from_start &&
+        unlikely((error= table->file->ha_rnd_init_with_error(1))))
     {
       DBUG_PRINT("info",("error initializing table scan"
                          " (ha_rnd_init returns %d)",error));
@@ -7761,6 +7772,15 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
     {
       if (unlikely((error= table->file->ha_rnd_next(table->record[0]))))
         DBUG_PRINT("info", ("error: %s", HA_ERR(error)));
+      if (error == HA_ERR_END_OF_FILE && !from_start)
+      {
+        DBUG_PRINT("info",("restarting the resumed table scan"));
+        from_start= true;
+        if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+          goto end;
+        if (unlikely((error= table->file->ha_rnd_next(table->record[0]))))
+          DBUG_PRINT("info", ("error: %s", HA_ERR(error)));
+      }
       switch (error) {
 
       case 0:
@@ -7893,7 +7913,9 @@ int Delete_rows_log_event::do_exec_row(rpl_group_info *rgi)
         unlikely(process_triggers(TRG_EVENT_DELETE, TRG_ACTION_AFTER, false,
                                   nullptr)))
       error= HA_ERR_GENERIC; // in case if error is not set yet
-    m_table->file->ha_index_or_rnd_end();
+    /* A table scan is resumed for the next row, see find_row() */
+    if (m_table->file->inited == handler::INDEX)
+      m_table->file->ha_index_end();
   }
   return error;
 }
@@ -8089,7 +8111,9 @@ Update_rows_log_event::do_exec_row(rpl_group_info *rgi)
     error= HA_ERR_GENERIC; // in case if error is not set yet
 
 err:
-  m_table->file->ha_index_or_rnd_end();
+  /* A table scan is resumed for the next row, see find_row() */
+  if (m_table->file->inited == handler::INDEX)
+    m_table->file->ha_index_end();
   return error;
 }
 
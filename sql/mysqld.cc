@@ -54,6 +54,7 @@
 #include "sys_vars_shared.h"
 #include "ddl_log.h"
 #include "optimizer_defaults.h"
+#include "filesort_utils.h" // filesort_thread_pool_end
 
 #include <m_ctype.h>
 #include <my_dir.h>
@@ -1186,7 +1187,7 @@ PSI_thread_key key_thread_delayed_insert,
   key_thread_handle_manager, key_thread_main,
   key_thread_one_connection, key_thread_signal_hand,
   key_thread_slave_background, key_rpl_parallel_thread;
-PSI_thread_key key_thread_ack_receiver;
+PSI_thread_key key_thread_ack_receiver, key_thread_filesort;
 
 static PSI_thread_info all_server_threads[]=
 {
@@ -1197,6 +1198,7 @@ static PSI_thread_info all_server_threads[]=
   { &key_thread_signal_hand, "signal_handler", PSI_FLAG_GLOBAL},
   { &key_thread_slave_background, "slave_bg", PSI_FLAG_GLOBAL},
   { &key_thread_ack_receiver, "Ack_receiver", PSI_FLAG_GLOBAL},
+  { &key_thread_filesort, "filesort_worker", PSI_FLAG_GLOBAL},
   { &key_rpl_parallel_thread, "rpl_parallel", 0}
 };
 
@@ -2025,6 +2027,7 @@ static void clean_up(bool print_message)
   sp_cache_end();
   free_status_vars();
   end_thr_timer();
+  filesort_thread_pool_end();
 #ifndef EMBEDDED_LIBRARY
   Events::deinit();
 #endif
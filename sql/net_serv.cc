@@ -118,6 +118,15 @@ extern my_bool thd_net_is_killed(THD *thd);
 
 
 static my_bool net_write_buff(NET *, const uchar *, size_t len);
+#ifdef HAVE_VIO_WRITEV
+static my_bool net_real_writev(NET *net, const uchar *buff, size_t buff_len,
+                               const uchar *packet, size_t len);
+/*
+  Packets at least this long that do not fit into the net buffer are
+  written directly from the caller's memory instead of being copied
+*/
+#define NET_WRITEV_MIN_LENGTH IO_SIZE
+#endif
 
 my_bool net_allocate_new_packet(NET *net, void *thd, uint my_flags);
 
@@ -237,12 +246,47 @@ my_bool net_realloc(NET *net, size_t length)
     /* In the server the error is reported by MY_WME flag. */
     DBUG_RETURN(1);
   }
-  net->buff=net->write_pos=buff;
+  /* Keep any reply that net_flush_reply() left in the buffer */
+  net->write_pos= buff + (net->write_pos - net->buff);
+  net->buff=buff;
   net->buff_end=buff+(net->max_packet= (ulong) pkt_length);
   DBUG_RETURN(0);
 }
 
 
+/**
+  Shrink the packet buffer after it has grown for a large packet.
+
+  Nothing is done while the buffer holds unsent or unread data,
+  or if the buffer cannot be reallocated.
+
+  @param net     network handler
+  @param length  the size to shrink the buffer to
+*/
+
+void net_shrink(NET *net, size_t length)
+{
+  uchar *buff;
+  size_t pkt_length= (length+IO_SIZE-1) & ~(IO_SIZE-1);
+  DBUG_ENTER("net_shrink");
+
+  if (net->max_packet <= pkt_length || net->write_pos != net->buff ||
+      net->remain_in_buf)
+    DBUG_VOID_RETURN;
+
+  if ((buff= (uchar*) my_realloc(key_memory_NET_buff,
+                                 (char*) net->buff, pkt_length +
+                                 NET_HEADER_SIZE + COMP_HEADER_SIZE + 1,
+                                 MYF(net->thread_specific_malloc
+                                     ? MY_THREAD_SPECIFIC : 0))))
+  {
+    net->buff=net->write_pos=net->read_pos=buff;
+    net->buff_end=buff+(net->max_packet= (ulong) pkt_length);
+  }
+  DBUG_VOID_RETURN;
+}
+
+
 /**
   Check if there is any data to be read from the socket.
 
@@ -395,6 +439,44 @@ my_bool net_flush(NET *net)
 }
 
 
+/**
+  Check whether the client has already sent the next command.
+
+  This is the case for pipelining clients, which send several
+  commands without waiting for the replies. Only a complete
+  uncompressed packet that has been read into the vio read buffer is
+  detected, so that my_net_read() will return it without blocking.
+  It must also fit into net->buff behind the buffered output, where
+  my_net_read() will put it.
+
+  @param net      network handler
+  @param command  the command byte of the next packet
+
+  @return whether the next command is available
+*/
+
+my_bool net_pending_command(NET *net, uchar *command)
+{
+#ifndef EMBEDDED_LIBRARY
+  Vio *vio= net->vio;
+  if (net->compress || !vio || vio->read != vio_read_buff)
+    return 0;
+  size_t available= (size_t) (vio->read_end - vio->read_pos);
+  if (available <= NET_HEADER_SIZE)
+    return 0;
+  size_t len= uint3korr(vio->read_pos);
+  if (!len || len >= MAX_PACKET_LENGTH || available < NET_HEADER_SIZE + len ||
+      (size_t) (net->write_pos - net->buff) + NET_HEADER_SIZE + len >=
+      net->max_packet)
+    return 0;
+  *command= (uchar) vio->read_pos[NET_HEADER_SIZE];
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+
 /*****************************************************************************
 ** Write something to server/client buffer
 *****************************************************************************/
@@ -581,6 +663,18 @@ net_write_buff(NET *net, const uchar *packet, size_t len)
 #endif
   if (len > left_length)
   {
+#ifdef HAVE_VIO_WRITEV
+    if (len >= NET_WRITEV_MIN_LENGTH && !net->compress &&
+        net->vio->write == vio_write)
+    {
+      /* Send the buffered data and the packet without copying the packet */
+      size_t used= (size_t) (net->write_pos - net->buff);
+      net->write_pos= net->buff;
+      if (!used)
+        return net_real_write(net, packet, len) ? 1 : 0;
+      return net_real_writev(net, net->buff, used, packet, len);
+    }
+#endif
     if (net->write_pos != net->buff)
     {
       /* Fill up already used packet and write it */
@@ -618,6 +712,62 @@ net_write_buff(NET *net, const uchar *packet, size_t len)
 }
 
 
+/**
+  Write a buffer to the vio, retrying on interrupts.
+  Sets net->error and reports the error if the write fails.
+
+  @return
+    @retval 0  ok
+    @retval 1  error
+*/
+
+static my_bool net_write_loop(NET *net, const uchar *pos, size_t len)
+{
+  size_t length;
+  const uchar *end= pos + len;
+  uint retry_count=0;
+
+  while (pos != end)
+  {
+    length= vio_write(net->vio, pos, (size_t) (end - pos));
+    if (ssize_t(length) <= 0)
+    {
+      bool interrupted= vio_should_retry(net->vio);
+      if (interrupted || !length)
+      {
+        if (retry_count++ < net->retry_count)
+          continue;
+      }
+      EXTRA_DEBUG_fprintf(stderr,
+                          "%s: write looped on vio with state %d, aborting thread\n",
+                          my_progname, (int) net->vio->type);
+      net->error= 2;				/* Close socket */
+
+      if (net->vio->state != VIO_STATE_SHUTDOWN || net->last_errno == 0)
+      {
+        net->last_errno= (interrupted ? ER_NET_WRITE_INTERRUPTED :
+                          ER_NET_ERROR_ON_WRITE);
+#ifdef MYSQL_SERVER
+        if (global_system_variables.log_warnings > 3)
+        {
+          sql_print_warning("Could not write packet: fd: %lld  state: %d  "
+                            "errno: %d  vio_errno: %d  length: %ld",
+                            (longlong) vio_fd(net->vio), (int) net->vio->state,
+                            vio_errno(net->vio), net->last_errno,
+                            (ulong) (end-pos));
+        }
+#endif
+      }
+      MYSQL_SERVER_my_error(net->last_errno, MYF(0));
+      break;
+    }
+    pos+=length;
+    update_statistics(thd_increment_bytes_sent(net->thd, length));
+  }
+  return pos != end;
+}
+
+
 /**
   Read and write one packet using timeouts.
   If needed, the packet is compressed before sending.
@@ -629,9 +779,6 @@ net_write_buff(NET *net, const uchar *packet, size_t len)
 int
 net_real_write(NET *net,const uchar *packet, size_t len)
 {
-  size_t length;
-  const uchar *pos,*end;
-  uint retry_count=0;
   DBUG_ENTER("net_real_write");
 
 #if defined(MYSQL_SERVER)
@@ -687,53 +834,78 @@ net_real_write(NET *net,const uchar *packet, size_t len)
 #ifdef DEBUG_DATA_PACKETS
   DBUG_DUMP("data_written", packet, len);
 #endif
-  pos= packet;
-  end=pos+len;
-  while (pos != end)
-  {
-    length= vio_write(net->vio, pos, (size_t) (end - pos));
-    if (ssize_t(length) <= 0)
-    {
-      bool interrupted= vio_should_retry(net->vio);
-      if (interrupted || !length)
-      {
-        if (retry_count++ < net->retry_count)
-          continue;
-      }
-      EXTRA_DEBUG_fprintf(stderr,
-                          "%s: write looped on vio with state %d, aborting thread\n",
-                          my_progname, (int) net->vio->type);
-      net->error= 2;				/* Close socket */
-
-      if (net->vio->state != VIO_STATE_SHUTDOWN || net->last_errno == 0)
-      {
-        net->last_errno= (interrupted ? ER_NET_WRITE_INTERRUPTED :
-                          ER_NET_ERROR_ON_WRITE);
-#ifdef MYSQL_SERVER
-        if (global_system_variables.log_warnings > 3)
-        {
-          sql_print_warning("Could not write packet: fd: %lld  state: %d  "
-                            "errno: %d  vio_errno: %d  length: %ld",
-                            (longlong) vio_fd(net->vio), (int) net->vio->state,
-                            vio_errno(net->vio), net->last_errno,
-                            (ulong) (end-pos));
-        }
-#endif
-      }
-      MYSQL_SERVER_my_error(net->last_errno, MYF(0));
-      break;
-    }
-    pos+=length;
-    update_statistics(thd_increment_bytes_sent(net->thd, length));
-  }
+  my_bool res= net_write_loop(net, packet, len);
 #ifdef HAVE_COMPRESS
   if (net->compress)
     my_free((void*) packet);
 #endif
   net->reading_or_writing= 0;
-  DBUG_RETURN(pos != end);
+  DBUG_RETURN(res);
 }
 
+#ifdef HAVE_VIO_WRITEV
+/**
+  Write the used part of the net buffer followed by a packet that does not
+  fit into it with one gathering write, instead of copying the packet into
+  the buffer first. Only for uncompressed writes to a plain socket.
+
+  @return
+    @retval 0  ok
+    @retval 1  error
+*/
+
+static my_bool net_real_writev(NET *net, const uchar *buff, size_t buff_len,
+                               const uchar *packet, size_t len)
+{
+  DBUG_ENTER("net_real_writev");
+  DBUG_ASSERT(!net->compress);
+
+#if defined(MYSQL_SERVER)
+  THD *thd= (THD *)net->thd;
+#if defined(USE_QUERY_CACHE)
+  query_cache_insert(thd, (char*) buff, buff_len, net->pkt_nr);
+  query_cache_insert(thd, (char*) packet, len, net->pkt_nr);
+#endif
+  if (likely(thd))
+    thd->async_state.wait_for_pending_ops();
+#endif
+
+  if (unlikely(net->error == 2))
+    DBUG_RETURN(1);				/* socket can't be used */
+
+  net->reading_or_writing=2;
+#ifdef DEBUG_DATA_PACKETS
+  DBUG_DUMP("data_written", buff, buff_len);
+  DBUG_DUMP("data_written", packet, len);
+#endif
+  struct iovec iov[2];
+  iov[0].iov_base= (void*) buff;
+  iov[0].iov_len= buff_len;
+  iov[1].iov_base= (void*) packet;
+  iov[1].iov_len= len;
+  size_t written= vio_writev(net->vio, iov, 2);
+  if (ssize_t(written) > 0)
+    update_statistics(thd_increment_bytes_sent(net->thd, written));
+  else
+    written= 0;
+
+  /* Write what is left (if anything) the usual way */
+  my_bool res= 0;
+  if (written < buff_len)
+  {
+    res= net_write_loop(net, buff + written, buff_len - written);
+    written= 0;
+  }
+  else
+    written-= buff_len;
+  if (!res && written < len)
+    res= net_write_loop(net, packet + written, len - written);
+  net->reading_or_writing= 0;
+  DBUG_RETURN(res);
+}
+#endif /* HAVE_VIO_WRITEV */
+
+
 /**
   Try to parse and process proxy protocol header.
 
@@ -1074,10 +1246,28 @@ my_net_read_packet_reallen(NET *net, my_bool read_from_server, ulong* reallen)
   MYSQL_NET_READ_START();
 
   *reallen = 0;
+  if (net->write_pos != net->buff)
+  {
+    /*
+      Replies to a pipelined command may still be buffered, see
+      net_pending_command(). Send them before waiting for the client.
+    */
+    uchar command;
+    if (!net_pending_command(net, &command) && net_flush(net))
+    {
+      MYSQL_NET_READ_DONE(1, 0);
+      return packet_error;
+    }
+  }
 #ifdef HAVE_COMPRESS
   if (!net->compress)
   {
 #endif
+    /*
+      Replies to a pipelined command may still be buffered,
+      see net_pending_command(). Read the next packet behind them.
+    */
+    net->where_b= (ulong) (net->write_pos - net->buff);
     len = my_real_read(net,&complen, read_from_server);
     if (len == MAX_PACKET_LENGTH)
     {
@@ -1096,6 +1286,7 @@ my_net_read_packet_reallen(NET *net, my_bool read_from_server, ulong* reallen)
     }
 
     net->read_pos = net->buff + net->where_b;
+    net->where_b= 0;
     if (likely(len != packet_error))
     {
       net->read_pos[len]=0;		/* Safeguard for mysql_use_result */
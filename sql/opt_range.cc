@@ -8538,6 +8538,35 @@ SEL_TREE *Item_func_in::get_func_mm_tree(RANGE_OPT_PARAM *param,
       }
     }
   }
+  else if (array && array->type_handler()->result_type() == INT_RESULT &&
+           array->used_count)
+  {
+    /*
+      We get here for "t.key IN (c1, c2, ...)" with integer constants.
+      The array is already sorted, so walk it once, skipping duplicates,
+      and add the point intervals in ascending order through a single
+      value item. Big IN lists (e.g. batched lookups by id) then cost one
+      SEL_ARG per distinct value instead of one per list element.
+    */
+    MEM_ROOT *tmp_root= param->mem_root;
+    param->thd->mem_root= param->old_root;
+    Item *value_item= array->create_item(param->thd);
+    param->thd->mem_root= tmp_root;
+    if (!value_item)
+      DBUG_RETURN(0);
+
+    for (uint i= 0; i < array->used_count; i++)
+    {
+      if (i && !array->compare_elems(i, i - 1))
+        continue;
+      array->value_to_item(i, value_item);
+      SEL_TREE *tree2= get_mm_parts(param, field, Item_func::EQ_FUNC,
+                                    value_item);
+      tree= i ? tree_or(param, tree, tree2) : tree2;
+      if (!tree)
+        break;
+    }
+  }
   else
   {
     tree= get_mm_parts(param, field, Item_func::EQ_FUNC, args[1]);
@@ -11787,15 +11816,14 @@ void prune_sel_arg_graph(SEL_ARG *sel_arg, uint max_part)
     SEL_ARG::next_key_part connections if necessary.
 
     We start with maximum used keypart and then remove one keypart after
-    another until the graph's weight is within the limit.
+    another until the graph's weight is within the limit. A graph over a
+    single keypart is never cut off.
 
   @seealso
      sel_arg_and_weight_heuristic();
 
   @return
-    tree pointer  The tree after processing,
-    NULL          If it was not possible to reduce the weight of the tree below
-                  the limit.
+    tree pointer  The tree after processing
 */
 
 SEL_ARG *enforce_sel_arg_weight_limit(RANGE_OPT_PARAM *param, uint keyno,
@@ -11818,10 +11846,11 @@ SEL_ARG *enforce_sel_arg_weight_limit(RANGE_OPT_PARAM *param, uint keyno,
     if (max_part == sel_arg->part)
     {
       /*
-        We don't return NULL right away as we want to have the information
-        about the changed tree in the optimizer trace.
+        A graph over a single key part is a plain list of intervals, e.g.
+        from a big "key IN (...)". Its weight is linear in the size of the
+        condition rather than combinatorial, so keep it: discarding it
+        would turn the lookup into a full scan.
       */
-      sel_arg= NULL;
       break;
     }
 
@@ -30,6 +30,33 @@
 static const unsigned int PACKET_BUFFER_EXTRA_ALLOC= 1024;
 #ifndef EMBEDDED_LIBRARY
 static bool write_eof_packet(THD *, NET *, uint, uint);
+
+/**
+  Flush the final reply to a command.
+
+  If the client has pipelined the next command, the reply is left in
+  the buffer and goes out together with the reply to that command,
+  saving a write per command. The reply is always flushed if the next
+  command is not answered (COM_QUIT, COM_STMT_CLOSE,
+  COM_STMT_SEND_LONG_DATA). my_net_read() flushes any buffered reply
+  before it would wait for the client.
+*/
+static bool net_flush_reply(NET *net)
+{
+  uchar command;
+  if (net_pending_command(net, &command))
+  {
+    switch (command) {
+    case COM_QUIT:
+    case COM_STMT_CLOSE:
+    case COM_STMT_SEND_LONG_DATA:
+      break;
+    default:
+      return false;
+    }
+  }
+  return net_flush(net);
+}
 #endif
 
 CHARSET_INFO *Protocol::character_set_results() const
@@ -280,7 +307,7 @@ Protocol::net_send_ok(THD *thd,
 
   error= my_net_write(net, (const unsigned char*)store.ptr(), store.length());
   if (likely(!error))
-    error= net_flush(net);
+    error= net_flush_reply(net);
 
   thd->get_stmt_da()->set_overwrite_status(false);
   DBUG_PRINT("info", ("OK sent, so no more error sending allowed"));
@@ -344,7 +371,7 @@ Protocol::net_send_eof(THD *thd, uint server_status, uint statement_warn_count)
     thd->get_stmt_da()->set_overwrite_status(true);
     error= write_eof_packet(thd, net, server_status, statement_warn_count);
     if (likely(!error))
-      error= net_flush(net);
+      error= net_flush_reply(net);
     thd->get_stmt_da()->set_overwrite_status(false);
     DBUG_PRINT("info", ("EOF sent, so no more error sending allowed"));
   }
@@ -600,50 +600,32 @@ TABLE::best_range_rowid_filter(uint access_key_no, double records,
 
 /**
   @brief
-    Fill the range rowid filter performing the associated range index scan
+    Fill a container of the range rowid filter performing a range index scan
+
+  @param sel   the select with the quick select for the range index scan
+  @param to    the container to put the rowids / primary keys into
+  @param from  if not NULL, only the rowids that are found in this sorted
+               container are placed into 'to'
 
-  @details
-    This function performs the range index scan associated with this
-    range filter and place into the filter the rowids / primary keys
-    read from key tuples when doing this scan.
   @retval
     Rowid_filter::SUCCESS          on success
     Rowid_filter::NON_FATAL_ERROR  the error which does not require transaction
                                    rollback
     Rowid_filter::FATAL_ERROR      the error which does require transaction
                                    rollback
-
-  @note
-    The function assumes that the quick select object to perform
-    the index range scan has been already created.
-
-  @note
-    Currently the same table handler is used to access the joined table
-    and to perform range index scan filling the filter.
-    In the future two different handlers will be used for this
-    purposes to facilitate a lazy building of the filter.
 */
 
-Rowid_filter::build_return_code Range_rowid_filter::build()
+Rowid_filter::build_return_code
+Range_rowid_filter::fill_container(SQL_SELECT *sel,
+                                   Rowid_filter_container *to,
+                                   Rowid_filter_container *from)
 {
   build_return_code rc= SUCCESS;
   handler *file= table->file;
   THD *thd= table->in_use;
-  QUICK_RANGE_SELECT* quick= (QUICK_RANGE_SELECT*) select->quick;
-  uint table_status_save= table->status;
-  Item *pushed_idx_cond_save= file->pushed_idx_cond;
-  uint pushed_idx_cond_keyno_save= file->pushed_idx_cond_keyno;
-  bool in_range_check_pushed_down_save= file->in_range_check_pushed_down;
+  QUICK_RANGE_SELECT* quick= (QUICK_RANGE_SELECT*) sel->quick;
   int org_keyread;
 
-  table->status= 0;
-  file->pushed_idx_cond= 0;
-  file->pushed_idx_cond_keyno= MAX_KEY;
-  file->in_range_check_pushed_down= false;
-
-  /* We're going to just read rowids / clustered primary keys */
-  table->prepare_for_position();
-
   org_keyread= file->ha_end_active_keyread();
   file->ha_start_keyread(quick->index);
 
@@ -671,7 +653,9 @@ Rowid_filter::build_return_code Range_rowid_filter::build()
         break;
       }
       file->position(quick->record);
-      if (container->add(NULL, (char *) file->ref))
+      if (from && !from->check(table, (char *) file->ref))
+        continue;
+      if (to->add(NULL, (char *) file->ref))
       {
         rc= NON_FATAL_ERROR;
         break;
@@ -683,6 +667,81 @@ Rowid_filter::build_return_code Range_rowid_filter::build()
   file->ha_end_keyread();
   file->ha_restart_keyread(org_keyread);
 
+  if (rc == SUCCESS)
+    to->sort(refpos_order_cmp, (void *) file);
+  return rc;
+}
+
+
+/**
+  @brief
+    Fill the range rowid filter performing the associated range index scan
+
+  @details
+    This function performs the range index scan associated with this
+    range filter and place into the filter the rowids / primary keys
+    read from key tuples when doing this scan.
+    If range scans over other indexes were attached to the filter, each of
+    them is performed next and only the rowids / primary keys found by all
+    the scans are kept in the filter.
+  @retval
+    Rowid_filter::SUCCESS          on success
+    Rowid_filter::NON_FATAL_ERROR  the error which does not require transaction
+                                   rollback
+    Rowid_filter::FATAL_ERROR      the error which does require transaction
+                                   rollback
+
+  @note
+    The function assumes that the quick select object to perform
+    the index range scan has been already created.
+
+  @note
+    Currently the same table handler is used to access the joined table
+    and to perform range index scan filling the filter.
+    In the future two different handlers will be used for this
+    purposes to facilitate a lazy building of the filter.
+*/
+
+Rowid_filter::build_return_code Range_rowid_filter::build()
+{
+  handler *file= table->file;
+  uint table_status_save= table->status;
+  Item *pushed_idx_cond_save= file->pushed_idx_cond;
+  uint pushed_idx_cond_keyno_save= file->pushed_idx_cond_keyno;
+  bool in_range_check_pushed_down_save= file->in_range_check_pushed_down;
+
+  table->status= 0;
+  file->pushed_idx_cond= 0;
+  file->pushed_idx_cond_keyno= MAX_KEY;
+  file->in_range_check_pushed_down= false;
+
+  /* We're going to just read rowids / clustered primary keys */
+  table->prepare_for_position();
+
+  build_return_code rc= fill_container(select, container, NULL);
+
+  List_iterator<SQL_SELECT> it(intersect_selects);
+  SQL_SELECT *sel;
+  while (rc == SUCCESS && !container->is_empty() && (sel= it++))
+  {
+    Rowid_filter_container *next= cost_info->create_container();
+    if (!next || next->alloc())
+    {
+      delete next;
+      break;                                // Keep the filter built so far
+    }
+    rc= fill_container(sel, next, container);
+    if (rc != SUCCESS)
+    {
+      delete next;
+      if (rc == NON_FATAL_ERROR)
+        rc= SUCCESS;                        // Keep the filter built so far
+      break;
+    }
+    delete container;
+    container= next;
+  }
+
   table->status= table_status_save;
   file->pushed_idx_cond= pushed_idx_cond_save;
   file->pushed_idx_cond_keyno= pushed_idx_cond_keyno_save;
@@ -694,7 +753,6 @@ Rowid_filter::build_return_code Range_rowid_filter::build()
   if (rc != SUCCESS)
     return rc;
 
-  container->sort(refpos_order_cmp, (void *) file);
   table->file->rowid_filter_is_active= true;
   return rc;
 }
@@ -744,4 +802,9 @@ Range_rowid_filter::~Range_rowid_filter()
   container= 0;
   delete select;
   select= 0;
+  List_iterator<SQL_SELECT> it(intersect_selects);
+  SQL_SELECT *sel;
+  while ((sel= it++))
+    delete sel;
+  intersect_selects.empty();
 }
@@ -259,6 +259,15 @@ class Range_rowid_filter: public Rowid_filter
   SQL_SELECT *select;
   /* The cost info on the filter (used for EXPLAIN/ANALYZE) */
   Range_rowid_filter_cost_info *cost_info;
+  /*
+    Range scans over other indexes whose rowids are intersected with
+    the ones of select (see max_rowid_filter_indexes)
+  */
+  List<SQL_SELECT> intersect_selects;
+
+  build_return_code fill_container(SQL_SELECT *sel,
+                                   Rowid_filter_container *to,
+                                   Rowid_filter_container *from);
 
 public:
   Range_rowid_filter(TABLE *tab,
@@ -272,6 +281,9 @@ class Range_rowid_filter: public Rowid_filter
 
   build_return_code build() override;
 
+  bool add_intersect_select(SQL_SELECT *sel, MEM_ROOT *mem_root)
+  { return intersect_selects.push_back(sel, mem_root); }
+
   bool check(char *elem) override
   {
     if (container->is_empty())
@@ -601,7 +601,8 @@ void Repl_semi_sync_master::remove_slave()
 
 int Repl_semi_sync_master::report_reply_packet(uint32 server_id,
                                                const uchar *packet,
-                                               ulong packet_len)
+                                               ulong packet_len,
+                                               Semi_sync_reply *reply)
 {
   int result= 1;                                // Assume error
   char log_file_name[FN_REFLEN+1];
@@ -653,7 +654,18 @@ int Repl_semi_sync_master::report_reply_packet(uint32 server_id,
                           log_file_name, (ulong)log_file_pos, server_id));
 
   rpl_semi_sync_master_get_ack++;
-  report_reply_binlog(server_id, log_file_name, log_file_pos);
+  if (!reply)
+    report_reply_binlog(server_id, log_file_name, log_file_pos);
+  else if (!reply->inited ||
+           Active_tranx::compare(log_file_name, log_file_pos,
+                                 reply->log_file_name,
+                                 reply->log_file_pos) > 0)
+  {
+    reply->server_id= server_id;
+    strmake_buf(reply->log_file_name, log_file_name);
+    reply->log_file_pos= log_file_pos;
+    reply->inited= true;
+  }
   DBUG_RETURN(0);
 
 l_end:
@@ -407,6 +407,21 @@ class Active_tranx
 
 };
 
+/**
+  The most advanced reply received from any semi-sync slave. Replies that
+  are behind another reply are ignored by report_reply_binlog() anyway, so
+  only the maximum needs to be reported.
+*/
+struct Semi_sync_reply
+{
+  uint32 server_id;
+  my_off_t log_file_pos;
+  char log_file_name[FN_REFLEN+1];
+  bool inited;
+
+  Semi_sync_reply() : inited(false) {}
+};
+
 /**
    The extension class for the master of semi-synchronous replication
 */
@@ -562,9 +577,22 @@ class Repl_semi_sync_master
   /* Remove a semi-sync replication slave */
   void remove_slave();
 
-  /* It parses a reply packet and call report_reply_binlog to handle it. */
+  /* It parses a reply packet and call report_reply_binlog to handle it.
+   * If reply is not NULL, the position is only merged into it, so that the
+   * ack receiver can report all replies of one wakeup with a single
+   * report_reply_batch() call.
+   */
   int report_reply_packet(uint32 server_id, const uchar *packet,
-                        ulong packet_len);
+                        ulong packet_len, Semi_sync_reply *reply= NULL);
+
+  /* Report the most advanced position collected by report_reply_packet() */
+  int report_reply_batch(const Semi_sync_reply *reply)
+  {
+    if (!reply->inited)
+      return 0;
+    return report_reply_binlog(reply->server_id, reply->log_file_name,
+                               reply->log_file_pos);
+  }
 
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events.
@@ -320,6 +320,12 @@ void Ack_receiver::run()
     listener.clear_signal();
     mysql_mutex_lock(&m_mutex);
     set_stage_info(stage_reading_semi_sync_ack);
+    /*
+      Read the replies from all ready slaves first and report only the most
+      advanced one, so that LOCK_binlog is taken once per wakeup instead of
+      once per reply.
+    */
+    Semi_sync_reply reply;
     Slave_ilist_iterator it(m_slaves);
     while ((slave= it++))
     {
@@ -354,7 +360,8 @@ void Ack_receiver::run()
         {
           int res;
           res= repl_semisync_master.report_reply_packet(slave->server_id(),
-                                                        net.read_pos, len);
+                                                        net.read_pos, len,
+                                                        &reply);
           if (unlikely(res < 0))
           {
             /*
@@ -378,6 +385,7 @@ void Ack_receiver::run()
       }
     }
     mysql_mutex_unlock(&m_mutex);
+    repl_semisync_master.report_reply_batch(&reply);
   }
 
 end:
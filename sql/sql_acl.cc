@@ -590,6 +590,27 @@ static const uchar *acl_entry_get_key(const void *entry_, size_t *length,
   return reinterpret_cast<const uchar *>(entry->key);
 }
 
+/*
+  Cached result of find_user_or_anon() for a host, ip and user name
+  of a connecting client, see find_user_or_anon_cached()
+*/
+class acl_user_entry :public hash_filo_element
+{
+public:
+  ACL_USER *user;                               // NULL if there is no match
+  uint16 length;
+  char key[1];					// Key will be stored here
+};
+
+
+static const uchar *acl_user_entry_get_key(const void *entry_, size_t *length,
+                                           my_bool)
+{
+  auto entry= static_cast<const acl_user_entry *>(entry_);
+  *length=(uint) entry->length;
+  return reinterpret_cast<const uchar *>(entry->key);
+}
+
 static const uchar *acl_role_get_key(const void *entry_, size_t *length,
                                      my_bool)
 {
@@ -720,6 +741,12 @@ static HASH acl_check_hosts, column_priv_hash, proc_priv_hash, func_priv_hash;
 static HASH package_spec_priv_hash, package_body_priv_hash;
 static DYNAMIC_ARRAY acl_wild_hosts;
 static Hash_filo<acl_entry> *acl_cache;
+/*
+  Points into acl_users, thus it is cleared by init_check_host()
+  whenever acl_users is reloaded, or a user is added, dropped or renamed.
+  Protected by acl_cache->lock (and its own lock, as Hash_filo requires).
+*/
+static Hash_filo<acl_user_entry> *acl_user_cache;
 static uint grant_version=0; /* Version of priv tables. incremented by acl_load */
 static privilege_t get_access(TABLE *form, uint fieldnr, uint *next_field=0);
 static int acl_compare(const void *a, const void *b);
@@ -2617,6 +2644,11 @@ bool acl_init(bool dont_read_acl_tables)
   acl_cache= new Hash_filo<acl_entry>(key_memory_acl_cache, ACL_CACHE_SIZE, 0,
                                       0, acl_entry_get_key, my_free,
                                       &my_charset_utf8mb3_bin);
+  acl_user_cache= new Hash_filo<acl_user_entry>(key_memory_acl_cache,
+                                                ACL_CACHE_SIZE, 0, 0,
+                                                acl_user_entry_get_key,
+                                                my_free, &my_charset_bin);
+  acl_user_cache->clear();
 
   /*
     cache built-in native authentication plugins,
@@ -3031,6 +3063,8 @@ void acl_free(bool end)
     plugin_unlock(0, old_password_plugin);
     delete acl_cache;
     acl_cache=0;
+    delete acl_user_cache;
+    acl_user_cache= 0;
   }
 }
 
@@ -3458,6 +3492,57 @@ static ACL_USER *find_user_or_anon(const char *host, const char *user, const cha
      user, host, ip, NULL, FALSE, NULL);
 }
 
+/*
+  find_user_or_anon() for authentication of new connections.
+
+  A reconnect storm repeats the same few user@host/ip combinations,
+  so the matching account (or the lack of it) is remembered in
+  acl_user_cache instead of matching host name patterns every time.
+*/
+static ACL_USER *find_user_or_anon_cached(const char *host, const char *user,
+                                          const char *ip)
+{
+  mysql_mutex_assert_owner(&acl_cache->lock);
+
+  const LEX_CSTRING host_str= Lex_cstring_strlen(safe_str(host));
+  const LEX_CSTRING ip_str= Lex_cstring_strlen(safe_str(ip));
+  const LEX_CSTRING user_str= Lex_cstring_strlen(safe_str(user));
+  if (host_str.length > HOSTNAME_LENGTH || ip_str.length > HOSTNAME_LENGTH ||
+      user_str.length > USERNAME_LENGTH)
+    return find_user_or_anon(host, user, ip);
+
+  /* NULL and empty host and ip do not match in the same way */
+  CharBuffer<2 * (1 + HOSTNAME_LENGTH + 1) + USERNAME_LENGTH> key;
+  key.append_char(host ? 'h' : '-').append(host_str).append_char('\0')
+     .append_char(ip ? 'i' : '-').append(ip_str).append_char('\0')
+     .append(user_str);
+
+  acl_user_entry *entry;
+  mysql_mutex_lock(&acl_user_cache->lock);
+  if ((entry= acl_user_cache->search((uchar*) key.ptr(), key.length())))
+  {
+    ACL_USER *acl_user= entry->user;
+    mysql_mutex_unlock(&acl_user_cache->lock);
+    return acl_user;
+  }
+  mysql_mutex_unlock(&acl_user_cache->lock);
+
+  ACL_USER *acl_user= find_user_or_anon(host, user, ip);
+
+  if ((entry= (acl_user_entry*) my_malloc(key_memory_acl_cache,
+                                          sizeof(acl_user_entry) +
+                                          key.length(), MYF(MY_WME))))
+  {
+    entry->user= acl_user;
+    entry->length= (uint16) key.length();
+    memcpy((uchar*) entry->key, key.ptr(), key.length());
+    mysql_mutex_lock(&acl_user_cache->lock);
+    acl_user_cache->add(entry);
+    mysql_mutex_unlock(&acl_user_cache->lock);
+  }
+  return acl_user;
+}
+
 
 static int check_user_can_set_role(THD *thd,
                                    const LEX_CSTRING &user,
@@ -3979,6 +4064,8 @@ privilege_t acl_get_all3(Security_context *sctx, const char *db,
 static void init_check_host(void)
 {
   DBUG_ENTER("init_check_host");
+  /* acl_user_cache points into acl_users, which has just changed */
+  acl_user_cache->clear();
   (void) my_init_dynamic_array(key_memory_acl_mem, &acl_wild_hosts,
                                sizeof(struct acl_host_and_ip),
                                acl_users.elements, 1, MYF(0));
@@ -14074,7 +14161,7 @@ static bool find_mpvio_user(MPVIO_EXT *mpvio)
 
   mysql_mutex_lock(&acl_cache->lock);
 
-  ACL_USER *user= find_user_or_anon(sctx->host, sctx->user, sctx->ip);
+  ACL_USER *user= find_user_or_anon_cached(sctx->host, sctx->user, sctx->ip);
 
   if (user && !user->dont_accept_new_connections())
     mpvio->acl_user= user->copy(mpvio->auth_info.thd->mem_root);
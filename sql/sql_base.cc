@@ -10181,7 +10181,14 @@ int TABLE::hlindexes_on_delete_all(bool truncate)
   return 0;
 }
 
-int TABLE::hlindex_read_first(uint nr, Item *item, ulonglong limit)
+/*
+  @param filter  condition on this table's rows that the results must
+                 satisfy, or nullptr. It is checked while traversing the
+                 index, so that LIMIT rows can be found without a large
+                 ef_search
+*/
+int TABLE::hlindex_read_first(uint nr, Item *item, ulonglong limit,
+                              Item *filter)
 {
   DBUG_ASSERT(s->hlindexes() == 1);
   DBUG_ASSERT(nr == s->keys);
@@ -10191,7 +10198,7 @@ int TABLE::hlindex_read_first(uint nr, Item *item, ulonglong limit)
 
   DBUG_ASSERT(hlindex->in_use == in_use);
 
-  return mhnsw_read_first(this, key_info + s->keys, item, limit);
+  return mhnsw_read_first(this, key_info + s->keys, item, limit, filter);
 }
 
 int TABLE::hlindex_read_next()
@@ -1732,6 +1732,11 @@ void THD::cleanup(void)
 
   mysql_ull_cleanup(this);
   stmt_map.reset();
+#ifdef HAVE_COMPRESS
+  /* The deflate state was allocated as memory of this session */
+  if (mysys_var == my_thread_var)
+    my_compress_free_state();
+#endif
   /* All metadata locks must have been released by now. */
   DBUG_ASSERT(!mdl_context.has_locks());
 
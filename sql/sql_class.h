@@ -796,6 +796,7 @@ typedef struct system_variables
 #endif /* WITH_WSREP */
 
   uint analyze_max_length;
+  uint sort_threads;
   ulong auto_increment_increment, auto_increment_offset;
   ulong column_compression_zlib_strategy;
   ulong lock_wait_timeout;
@@ -885,6 +886,7 @@ typedef struct system_variables
   uint column_compression_zlib_level;
   uint in_subquery_conversion_threshold;
   uint max_open_cursors;
+  uint max_rowid_filter_indexes;
   int max_user_connections;
 
   /**
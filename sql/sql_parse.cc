@@ -2466,6 +2466,18 @@ dispatch_command_return dispatch_command(enum enum_server_command command, THD *
   thd->m_digest= NULL;
 
   thd->packet.shrink(thd->variables.net_buffer_length); // Reclaim some memory
+#ifndef EMBEDDED_LIBRARY
+  /*
+    net->buff keeps the size of the largest packet, which is often
+    max_allowed_packet, for the rest of the connection. Do not keep
+    that while the connection is idle.
+  */
+  net_shrink(&thd->net, thd->variables.net_buffer_length);
+#endif
+#ifdef HAVE_COMPRESS
+  /* Do not keep the deflate state of my_compress_buffer() while idle */
+  my_compress_free_state();
+#endif
 
   thd->reset_kill_query();  /* Ensure that killed_errmsg is released */
   /*
@@ -2064,6 +2064,76 @@ int JOIN::optimize_stage2_and_finish()
 }
 
 
+/**
+  @brief
+    Attach range scans over other indexes to the range filter of a table
+
+  @details
+    If max_rowid_filter_indexes allows it, the function looks for other
+    usable range filters of the table of 'tab' that still promise a gain
+    when applied to the rows passing the range filter 'filter'. Each range
+    scan found this way is added to 'filter', which keeps only the rowids
+    that are returned by all its scans.
+
+  @retval false  Ok
+  @retval true   Error, query should abort
+*/
+
+static bool add_rowid_filter_intersections(JOIN *join, JOIN_TAB *tab,
+                                           Range_rowid_filter *filter)
+{
+  THD *thd= join->thd;
+  TABLE *table= tab->table;
+  uint max_indexes= thd->variables.max_rowid_filter_indexes;
+  Range_rowid_filter_cost_info *filter_info= tab->range_rowid_filter_info;
+  uint access_key= (tab->ref.key >= 0 ? (uint) tab->ref.key :
+                    tab->quick ? tab->quick->index : MAX_KEY);
+  double rows= tab->records_init * filter_info->selectivity;
+
+  for (uint i= 0;
+       i < table->range_rowid_filter_cost_info_elems && max_indexes > 1;
+       i++)
+  {
+    Range_rowid_filter_cost_info *info=
+      table->range_rowid_filter_cost_info_ptr[i];
+    uint key_no= info->get_key_no();
+    if (key_no == filter_info->get_key_no() || key_no == access_key ||
+        info->get_gain(rows) <= 0)
+      continue;
+
+    int err;
+    Item **sargable_cond= get_sargable_cond(join, table);
+    SQL_SELECT *sel= make_select(table, join->const_table_map,
+                                 join->const_table_map, *sargable_cond,
+                                 (SORT_INFO*) 0, 1, &err);
+    if (!sel)
+      continue;
+
+    key_map filter_map;
+    filter_map.clear_all();
+    filter_map.set_bit(key_no);
+    quick_select_return rc;
+    rc= sel->test_quick_select(thd, filter_map, (table_map) 0,
+                               (ha_rows) HA_POS_ERROR, true, false, true,
+                               true, Item_func::BITMAP_EXCEPT_ANY_EQUALITY);
+    if (rc == SQL_SELECT::ERROR || thd->is_error() || thd->check_killed())
+    {
+      delete sel;
+      return true;
+    }
+    if (rc != SQL_SELECT::OK || !sel->quick ||
+        filter->add_intersect_select(sel, thd->mem_root))
+    {
+      delete sel;
+      continue;
+    }
+    max_indexes--;
+    rows*= info->selectivity;
+  }
+  return false;
+}
+
+
 /**
   @brief
     Create range filters objects needed in execution for all join tables
@@ -2150,13 +2220,16 @@ bool JOIN::make_range_rowid_filters()
       tab->range_rowid_filter_info->create_container();
     if (filter_container)
     {
-      tab->rowid_filter=
+      Range_rowid_filter *filter=
         new (thd->mem_root) Range_rowid_filter(tab->table,
                                                tab->range_rowid_filter_info,
                                                filter_container, sel);
+      tab->rowid_filter= filter;
       if (tab->rowid_filter)
       {
         tab->need_to_build_rowid_filter= true;
+        if (add_rowid_filter_intersections(this, tab, filter))
+          DBUG_RETURN(true); /* Fatal error */
         continue;
       }
     }
@@ -25686,9 +25759,20 @@ join_read_first(JOIN_TAB *tab)
     DBUG_ASSERT(order);
     DBUG_ASSERT(order->next == NULL);
     DBUG_ASSERT(order->item[0]->real_item()->type() == Item::FUNC_ITEM);
+    /*
+      Let the index search skip the rows that the attached condition
+      rejects. It is evaluated again for the returned rows, so only
+      cheap conditions that depend on nothing but this table and the
+      const tables are pushed.
+    */
+    Item *filter= tab->select_cond;
+    if (filter &&
+        (filter->is_expensive() ||
+         (filter->used_tables() & ~(table->map | tab->join->const_table_map))))
+      filter= NULL;
     tab->read_record.read_record_func= join_hlindex_read_next;
     error= tab->table->hlindex_read_first(tab->index, *order->item,
-                                          tab->join->select_limit);
+                                          tab->join->select_limit, filter);
   }
   else
   {
@@ -25702,7 +25786,9 @@ join_read_first(JOIN_TAB *tab)
   }
   if (error)
   {
-    if (error != HA_ERR_KEY_NOT_FOUND && error != HA_ERR_END_OF_FILE)
+    /* the pushed filter may have failed and reported the error itself */
+    if (error != HA_ERR_KEY_NOT_FOUND && error != HA_ERR_END_OF_FILE &&
+        !table->in_use->is_error())
       report_error(table, error);
     DBUG_RETURN(-1);
   }
@@ -25724,7 +25810,8 @@ join_read_next(READ_RECORD *info)
 static int join_hlindex_read_next(READ_RECORD *info)
 {
   if (int error= info->table->hlindex_read_next())
-    return report_error(info->table, error);
+    return info->table->in_use->is_error() ? 1
+                                           : report_error(info->table, error);
   return 0;
 }
 
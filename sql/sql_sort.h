@@ -560,6 +560,7 @@ class Sort_param {
   uint res_length;
   uint max_keys_per_buffer;   // Max keys / buffer.
   uint min_dupl_count;
+  uint max_sort_threads;      // Max threads for sorting a buffer.
   ha_rows limit_rows;         // Select limit, or HA_POS_ERROR if unlimited.
   ha_rows examined_rows;      // Number of examined rows.
   TABLE *sort_form;           // For quicker make_sortkey.
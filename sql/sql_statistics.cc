@@ -2554,6 +2554,10 @@ bool Column_statistics_collected::finish(MEM_ROOT *mem_root, ha_rows rows,
        the number of distinct values.
        With a sufficient large percentage of rows sampled (80%), we revert back
        to computing the avg_frequency off of the raw data.
+       The estimator assumes that each row was sampled independently.
+       handler::sample_next() may return whole blocks of adjacent rows
+       instead, which makes avg_frequency too large for columns that are
+       correlated with the physical order of the rows.
       */
       if (sample_fraction > 0.8)
         val= (double) (rows - nulls) / distincts;
@@ -2788,12 +2792,13 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
 
   restore_record(table, s->default_values);
 
-  /* Perform a full table scan to collect statistics on 'table's columns */
+  /* Scan a sample of the table to collect statistics on 'table's columns */
   if (!(rc= file->ha_rnd_init(TRUE)))
   {
     DEBUG_SYNC(table->in_use, "statistics_collection_start");
 
-    while ((rc= file->ha_rnd_next(table->record[0])) != HA_ERR_END_OF_FILE)
+    while ((rc= file->ha_sample_next(table->record[0], sample_fraction)) !=
+           HA_ERR_END_OF_FILE)
     {
       if (thd->killed)
         break;
@@ -2801,20 +2806,17 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
       if (rc)
         break;
 
-      if (thd_rnd(thd) <= sample_fraction)
+      for (field_ptr= table->field; *field_ptr; field_ptr++)
       {
-        for (field_ptr= table->field; *field_ptr; field_ptr++)
-        {
-          table_field= *field_ptr;
-          if (!table_field->collected_stats)
-            continue;
-          if ((rc= table_field->collected_stats->add()))
-            break;
-        }
-        if (rc)
+        table_field= *field_ptr;
+        if (!table_field->collected_stats)
+          continue;
+        if ((rc= table_field->collected_stats->add()))
           break;
-        rows++;
       }
+      if (rc)
+        break;
+      rows++;
     }
     file->ha_rnd_end();
   }
@@ -2828,6 +2830,11 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
   if (!rc)
   {
     table->collected_stats->cardinality_is_null= FALSE;
+    /*
+      If the engine sampled blocks, it stopped after about
+      sample_fraction of its own estimate of the number of rows,
+      and this is no more accurate than that estimate.
+    */
     table->collected_stats->cardinality=
       static_cast<ha_rows>(rows / sample_fraction);
   }
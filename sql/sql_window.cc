@@ -2789,6 +2789,26 @@ bool get_window_functions_required_cursors(
   return false;
 }
 
+/**
+  Position the table on the current row again after the frame cursors
+  have been moved.
+
+  @detail
+    The frame cursors read rows with ha_rnd_pos() into tbl->record[0].
+    Many frames (e.g. ROWS BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW)
+    never fetch any row other than the current one, so the handler is
+    often still positioned on the current row and the read can be skipped.
+*/
+static
+int restore_current_row(TABLE *tbl, uchar *rowid_buf)
+{
+  handler *file= tbl->file;
+  file->position(tbl->record[0]);
+  if (!memcmp(file->ref, rowid_buf, file->ref_length))
+    return 0;
+  return file->ha_rnd_pos(tbl->record[0], rowid_buf);
+}
+
 /**
   Helper function that takes a list of window functions and writes
   their values in the current table record.
@@ -2799,7 +2819,8 @@ bool save_window_function_values(List<Item_window_func>& window_functions,
 {
   List_iterator_fast<Item_window_func> iter(window_functions);
   JOIN_TAB *join_tab= tbl->reginfo.join_tab;
-  tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf);
+  if (restore_current_row(tbl, rowid_buf))
+    return true;
   store_record(tbl, record[1]);
   while (Item_window_func *item_win= iter++)
     item_win->save_in_field(item_win->result_field, true);
@@ -2952,7 +2973,7 @@ bool compute_window_func(THD *thd,
 
       /* Return to current row after notifying cursors for each window
          function. */
-      if (tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf))
+      if (restore_current_row(tbl, rowid_buf))
       {
         ret= true;
         break;
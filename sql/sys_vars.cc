@@ -3995,6 +3995,12 @@ static Sys_var_ulonglong Sys_sort_buffer(
        VALID_RANGE(MIN_SORT_MEMORY, SIZE_T_MAX), DEFAULT(MAX_SORT_MEMORY),
        BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_sort_threads(
+       "sort_threads",
+       "Maximum number of threads that sort a full sort buffer",
+       SESSION_VAR(sort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
 export sql_mode_t expand_sql_mode(sql_mode_t sql_mode)
 {
   if (sql_mode & MODE_ANSI)
@@ -7524,6 +7530,14 @@ static Sys_var_enum Sys_secure_timestamp(
        READ_ONLY GLOBAL_VAR(opt_secure_timestamp), CMD_LINE(REQUIRED_ARG),
        secure_timestamp_levels, DEFAULT(SECTIME_NO));
 
+static Sys_var_uint Sys_max_rowid_filter_indexes(
+       "max_rowid_filter_indexes",
+       "The maximum number of indexes whose ranges are intersected to build "
+       "a rowid filter. If set to 1, only the index chosen by the optimizer "
+       "is used",
+       SESSION_VAR(max_rowid_filter_indexes), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, MAX_KEY), DEFAULT(1), BLOCK_SIZE(1));
+
 static Sys_var_ulonglong Sys_max_rowid_filter_size(
        "max_rowid_filter_size",
        "The maximum size of the container of a rowid filter",
@@ -392,6 +392,12 @@ void tc_add_table(THD *thd, TABLE *table)
 
   Acquired object cannot be evicted or acquired again.
 
+  If the instance of this thread has no unused object, unused objects
+  of other instances are taken, so that a thread does not open a new
+  TABLE while another instance has a free one. Other instances are
+  only locked if their mutex is not contended; the object keeps its
+  TABLE::instance and is released back to the instance it came from.
+
   @return TABLE object, or NULL if no unused objects.
 */
 
@@ -403,16 +409,32 @@ TABLE *tc_acquire_table(THD *thd, TDC_element *element)
 
   tc[i].lock_and_check_contention(n_instances, i);
   table= element->free_tables[i].list.pop_front();
-  if (table)
+  if (!table)
   {
-    DBUG_ASSERT(!table->in_use);
-    table->in_use= thd;
-    /* The ex-unused table must be fully functional. */
-    DBUG_ASSERT(table->db_stat && table->file);
-    /* The children must be detached from the table. */
-    DBUG_ASSERT(!table->file->extra(HA_EXTRA_IS_ATTACHED_CHILDREN));
-    tc[i].free_tables.remove(table);
+    mysql_mutex_unlock(&tc[i].LOCK_table_cache);
+    for (uint32_t n= 1; n < n_instances; n++)
+    {
+      uint32_t j= (i + n) % n_instances;
+      if (mysql_mutex_trylock(&tc[j].LOCK_table_cache))
+        continue;
+      if ((table= element->free_tables[j].list.pop_front()))
+      {
+        i= j;
+        break;
+      }
+      mysql_mutex_unlock(&tc[j].LOCK_table_cache);
+    }
+    if (!table)
+      return NULL;
   }
+  DBUG_ASSERT(table->instance == i);
+  DBUG_ASSERT(!table->in_use);
+  table->in_use= thd;
+  /* The ex-unused table must be fully functional. */
+  DBUG_ASSERT(table->db_stat && table->file);
+  /* The children must be detached from the table. */
+  DBUG_ASSERT(!table->file->extra(HA_EXTRA_IS_ATTACHED_CHILDREN));
+  tc[i].free_tables.remove(table);
   mysql_mutex_unlock(&tc[i].LOCK_table_cache);
   return table;
 }
@@ -119,6 +119,8 @@ static void queue_put(thread_group_t *thread_group, native_event *ev, int cnt);
 static int  wake_thread(thread_group_t *thread_group,bool due_to_stall);
 static int  wake_or_create_thread(thread_group_t *thread_group, bool due_to_stall=false);
 static int  create_worker(thread_group_t *thread_group, bool due_to_stall);
+static int  change_group(TP_connection_generic *c, thread_group_t *old_group,
+                         thread_group_t *new_group);
 static void *worker_main(void *param);
 static void check_stall(thread_group_t *thread_group);
 static void set_next_timeout_check(ulonglong abstime);
@@ -609,6 +611,36 @@ static void* timer_thread(void *param)
 
 
 
+/*
+  Wake an idle worker in another group, so that it steals work
+  from the stalled group (see steal_connection()).
+
+  Neighbouring groups are tried first. The caller holds the mutex of
+  the stalled group, thus the other groups' mutexes are only try-locked.
+
+  @return true if a worker was woken.
+*/
+static bool wake_stealer(thread_group_t *thread_group)
+{
+  uint group_id= (uint) (thread_group - all_groups);
+  if (group_id >= group_count)
+    return false;
+
+  for (uint i= 1; i < group_count; i++)
+  {
+    thread_group_t *group= &all_groups[(group_id + i) % group_count];
+    if (mysql_mutex_trylock(&group->mutex))
+      continue;
+    bool woken= !group->shutdown && is_queue_empty(group) &&
+      !wake_thread(group, true);
+    mysql_mutex_unlock(&group->mutex);
+    if (woken)
+      return true;
+  }
+  return false;
+}
+
+
 void check_stall(thread_group_t *thread_group)
 {
   mysql_mutex_lock(&thread_group->mutex);
@@ -656,8 +688,12 @@ void check_stall(thread_group_t *thread_group)
     2. Timer determines stall if this counter remains 0 since last check
        and the queue is not empty.
     3. Once timer determined a stall it sets thread_group->stalled flag and
-       wakes and idle worker (or creates a new one, subject to throttling).
-    4. The stalled flag is reset, when an event is dequeued.
+       wakes an idle worker. An idle worker of the own group is preferred,
+       then an idle worker of another group, which will steal queued
+       events from the stalled group. Only if there is no idle worker
+       anywhere, a new one is created (subject to throttling).
+    4. The stalled flag is reset, when an event is dequeued by a worker
+       of the group.
 
     Q : Will this handling lead to an unbound growth of threads, if queue
     stalls permanently?
@@ -676,7 +712,9 @@ void check_stall(thread_group_t *thread_group)
   {
     thread_group->stalled= true;
     TP_INCREMENT_GROUP_COUNTER(thread_group,stalls);
-    wake_or_create_thread(thread_group,true);
+    if (!thread_group->waiting_threads.is_empty() ||
+        !wake_stealer(thread_group))
+      wake_or_create_thread(thread_group,true);
   }
 
   /* Reset queue event count */
@@ -1145,6 +1183,48 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/*
+  Steal a queued event from a stalled group.
+
+  Groups are scanned starting with the neighbour of the current group,
+  so that a stalled group is relieved by the same few groups, rather
+  than by all of them at once. The stolen connection migrates to the
+  current group, so that wait_begin()/wait_end() and the stall detection
+  account for it in the group that actually executes it. It stays in
+  the new group, which spreads the heavy sessions that happened to hash
+  into the same group.
+
+  The caller must not hold any group mutex.
+*/
+static TP_connection_generic *steal_connection(thread_group_t *thread_group)
+{
+  uint group_id= (uint) (thread_group - all_groups);
+  if (group_id >= group_count)
+    return NULL;
+
+  for (uint i= 1; i < group_count; i++)
+  {
+    thread_group_t *group= &all_groups[(group_id + i) % group_count];
+    /* Dirty read, rechecked under the mutex. */
+    if (!group->stalled)
+      continue;
+
+    mysql_mutex_lock(&group->mutex);
+    TP_connection_generic *connection= NULL;
+    if (group->stalled && !group->shutdown)
+      connection= queue_get(group, operation_origin::WORKER);
+    mysql_mutex_unlock(&group->mutex);
+
+    if (connection)
+    {
+      change_group(connection, group, thread_group);
+      return connection;
+    }
+  }
+  return NULL;
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1171,6 +1251,7 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
 {
   DBUG_ENTER("get_event");
   TP_connection_generic *connection = NULL;
+  bool tried_stealing= false;
 
 
   mysql_mutex_lock(&thread_group->mutex);
@@ -1228,6 +1309,21 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /*
+      Before sleeping, help a stalled group. The mutex is released for
+      that, so recheck our own group afterwards.
+    */
+    if (!oversubscribed && !tried_stealing && group_count > 1)
+    {
+      tried_stealing= true;
+      mysql_mutex_unlock(&thread_group->mutex);
+      connection= steal_connection(thread_group);
+      mysql_mutex_lock(&thread_group->mutex);
+      if (connection)
+        break;
+      continue;
+    }
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -1250,6 +1346,7 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       err = mysql_cond_wait(&current_thread->cond, &thread_group->mutex);
     }
     thread_group->active_thread_count++;
+    tried_stealing= false;
 
     if (!current_thread->woken)
     {
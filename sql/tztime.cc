@@ -591,6 +591,19 @@ sec_to_TIME(MYSQL_TIME * tmp, my_time_t t, long offset)
 }
 
 
+/*
+  The range that was found by the last find_time_range() call of this
+  thread. Consecutive conversions usually fall into the same range
+  (e.g. the same DST period), so it is checked before the binary search.
+*/
+struct Time_range_hint
+{
+  const my_int_time_t *range_boundaries;
+  uint index;
+};
+
+static thread_local Time_range_hint transition_hint, rev_range_hint;
+
 /*
   Find time range which contains given my_time_t value
 
@@ -599,6 +612,7 @@ sec_to_TIME(MYSQL_TIME * tmp, my_time_t t, long offset)
       t                - my_time_t value for which we looking for range
       range_boundaries - sorted array of range starts.
       higher_bound     - number of ranges
+      hint             - range of the previous lookup in this thread
 
   DESCRIPTION
     Performs binary search for range which contains given my_time_t value.
@@ -609,12 +623,15 @@ sec_to_TIME(MYSQL_TIME * tmp, my_time_t t, long offset)
     With this localtime_r on real data may takes less time than with linear
     search (I've seen 30% speed up).
 
+    If t belongs to the range that was found by the previous lookup in
+    the same array, the search is skipped.
+
   RETURN VALUE
     Index of range to which t belongs
 */
 static uint
 find_time_range(my_int_time_t t, const my_int_time_t *range_boundaries,
-                uint higher_bound)
+                uint higher_bound, Time_range_hint *hint)
 {
   uint i, lower_bound= 0;
 
@@ -623,6 +640,14 @@ find_time_range(my_int_time_t t, const my_int_time_t *range_boundaries,
   */
   DBUG_ASSERT(higher_bound > 0 && t >= range_boundaries[0]);
 
+  if (hint->range_boundaries == range_boundaries)
+  {
+    i= hint->index;
+    if (i < higher_bound && range_boundaries[i] <= t &&
+        (i + 1 == higher_bound || t < range_boundaries[i + 1]))
+      return i;
+  }
+
   /*
     Do binary search for minimal interval which contain t. We preserve:
     range_boundaries[lower_bound] <= t < range_boundaries[higher_bound]
@@ -638,6 +663,8 @@ find_time_range(my_int_time_t t, const my_int_time_t *range_boundaries,
     else
       higher_bound= i;
   }
+  hint->range_boundaries= range_boundaries;
+  hint->index= lower_bound;
   return lower_bound;
 }
 
@@ -671,7 +698,8 @@ find_transition_type(my_time_t t, const TIME_ZONE_INFO *sp)
     contain t. With this localtime_r on real data may takes less
     time than with linear search (I've seen 30% speed up).
   */
-  return &(sp->ttis[sp->types[find_time_range(t, sp->ats, sp->timecnt)]]);
+  return &(sp->ttis[sp->types[find_time_range(t, sp->ats, sp->timecnt,
+                                                 &transition_hint)]]);
 }
 
 
@@ -939,7 +967,7 @@ a  */
   }
 
   /* binary search for our range */
-  i= find_time_range(local_t, sp->revts, sp->revcnt);
+  i= find_time_range(local_t, sp->revts, sp->revcnt, &rev_range_hint);
 
   /*
     As there are no offset switches at the end of TIMESTAMP range,
@@ -1068,6 +1068,11 @@ struct MHNSW_param
   Stats acc;
   dgt_mode mode;
   double max_est_size;
+  /* condition on the base table rows that the results must satisfy */
+  Item *filter= nullptr;
+  TABLE *table= nullptr;
+  /* set by search_layer() if it gave up, see filter_ef_factor */
+  bool filter_gave_up= false;
   MHNSW_param(MHNSW_Share *ctx, TABLE *graph, int layer)
     : ctx(ctx), graph(graph), layer(layer)
   {
@@ -1282,6 +1287,45 @@ static inline float generous_furthest(const Queue<Visited> &q, float maxd, float
   return d*(1 + (g - 1)/2 * (1 - sigmoid));
 }
 
+/*
+  With a selective filter the result may never fill up, and the search
+  would walk the whole graph. It gives up after this many times ef rows
+  were checked against the filter or this many times ef nodes were
+  expanded. The caller then repeats the search without the filter and
+  does not use it for the following reads either: the SQL layer checks
+  every returned row, so this affects only the speed, not the result.
+*/
+static constexpr uint filter_ef_factor= 16;
+
+/*
+  Filtered-out nodes are still used to navigate the graph, they only
+  cannot be in the result. The row is read into table->record[0].
+
+  @return 0 if the row satisfies the filter, -1 if it does not,
+          or an error code
+*/
+static int filtered_out(MHNSW_param *p, FVectorNode *node)
+{
+  TABLE *table= p->table;
+  switch (int err= table->file->ha_rnd_pos(table->record[0], node->tref())) {
+  case 0:
+    break;
+  case HA_ERR_RECORD_DELETED:
+  case HA_ERR_KEY_NOT_FOUND:
+    return -1;
+  default:
+    return err;
+  }
+  const bool match= p->filter->val_bool();
+  if (table->in_use->is_error())
+    return HA_ERR_GENERIC;
+  if (match)
+    return 0;
+  /* like evaluate_join_record(), do not keep a lock on a rejected row */
+  table->file->unlock_row();
+  return -1;
+}
+
 /*
   @param[in/out] inout    in: start nodes, out: result nodes
 */
@@ -1308,6 +1352,20 @@ static int search_layer(MHNSW_param *p, const FVector *target, float threshold,
     if (ef > 1 || p->layer == 0)
       ef= std::max(THDVAR(p->graph->in_use, ef_search), ef);
   }
+  Item *const filter= skip_deleted ? p->filter : nullptr;
+  const size_t max_filtered= filter
+    ? size_t{ef} * filter_ef_factor : SIZE_MAX;
+  size_t n_filtered= 0, n_expanded= 0;
+  int filter_err= 0;
+  /* @return whether the node cannot be in the result */
+  auto rejected= [&](FVectorNode *node)
+  {
+    n_filtered++;
+    int res= filtered_out(p, node);
+    if (res > 0)
+      filter_err= res;
+    return res != 0;
+  };
 
   // WARNING! heuristic here
   const double est_heuristic= 8 * std::sqrt(p->ctx->max_neighbors(p->layer));
@@ -1325,8 +1383,13 @@ static int search_layer(MHNSW_param *p, const FVector *target, float threshold,
     Visited *v= visited.create(node, node->distance_to(target));
     p->acc.diameter= std::max(p->acc.diameter, v->distance_to_target);
     candidates.push(v);
-    if ((skip_deleted && v->node->deleted) || threshold > NEAREST)
+    if ((skip_deleted && v->node->deleted) || threshold > NEAREST ||
+        (filter && rejected(v->node)))
+    {
+      if (filter_err)
+        return filter_err;
       continue;
+    }
     best.push(v);
   }
 
@@ -1337,6 +1400,15 @@ static int search_layer(MHNSW_param *p, const FVector *target, float threshold,
     const Visited &cur= *candidates.pop();
     if (cur.distance_to_target > furthest_best && best.is_full())
       break; // All possible candidates are worse than what we have
+    if (++n_expanded > max_filtered || n_filtered > max_filtered)
+    {
+      /*
+        the filter is too selective, see filter_ef_factor.
+        inout is left unchanged, the caller can search again from it.
+      */
+      p->filter_gave_up= true;
+      return 0;
+    }
 
     visited.flush();
 
@@ -1361,8 +1433,13 @@ static int search_layer(MHNSW_param *p, const FVector *target, float threshold,
             continue;
           p->acc.diameter= std::max(p->acc.diameter, v->distance_to_target);
           candidates.safe_push(v);
-          if (skip_deleted && v->node->deleted)
+          if ((skip_deleted && v->node->deleted) ||
+              (filter && rejected(v->node)))
+          {
+            if (filter_err)
+              return filter_err;
             continue;
+          }
           best.push(v);
           furthest_best= generous_furthest(best, p->acc.diameter, generosity);
         }
@@ -1378,17 +1455,25 @@ static int search_layer(MHNSW_param *p, const FVector *target, float threshold,
             candidates.safe_push(v);
             if (skip_deleted && v->node->deleted)
               continue;
-            if (v->distance_to_target < best.top()->distance_to_target)
+            if (v->distance_to_target < best.top()->distance_to_target &&
+                !(filter && rejected(v->node)))
             {
               best.replace_top(v);
               furthest_best= generous_furthest(best, p->acc.diameter, generosity);
             }
+            else if (filter_err)
+              return filter_err;
           }
         }
       }
     }
   }
-  if (ef > 1 && visited.count > est_size)
+  /*
+    A filtered search visits more nodes than the graph otherwise needs;
+    do not let it inflate ef_power, which add_to_stats() shares with
+    all searches.
+  */
+  if (ef > 1 && !filter && visited.count > est_size)
   {
     double ef_power= std::log(visited.count/est_heuristic) / std::log(ef);
     p->acc.ef_power= std::max(p->acc.ef_power, ef_power);
@@ -1513,12 +1598,16 @@ struct Search_context: public Sql_alloc
   ulonglong ctx_version;
   size_t pos= 0;
   float threshold= NEAREST/2;
-  Search_context(Neighborhood *n, MHNSW_Share *s, const FVector *v)
-    : found(*n), ctx(s->dup(false)), target(v), ctx_version(ctx->version) {}
+  Item *filter;
+  Search_context(Neighborhood *n, MHNSW_Share *s, const FVector *v,
+                 Item *filter)
+    : found(*n), ctx(s->dup(false)), target(v), ctx_version(ctx->version),
+      filter(filter) {}
 };
 
 
-int mhnsw_read_first(TABLE *table, KEY *keyinfo, Item *dist, ulonglong limit)
+int mhnsw_read_first(TABLE *table, KEY *keyinfo, Item *dist, ulonglong limit,
+                     Item *filter)
 {
   THD *thd= table->in_use;
   TABLE *graph= table->hlindex;
@@ -1576,15 +1665,28 @@ int mhnsw_read_first(TABLE *table, KEY *keyinfo, Item *dist, ulonglong limit)
     }
   }
 
+  p.filter= filter;
+  p.table= table;
   if (int err= search_layer(&p, target, NEAREST, static_cast<uint>(limit),
                             &candidates, false))
   {
     graph->file->ha_rnd_end();
     return err;
   }
+  if (p.filter_gave_up)
+  {
+    p.filter= nullptr;
+    if (int err= search_layer(&p, target, NEAREST, static_cast<uint>(limit),
+                              &candidates, false))
+    {
+      graph->file->ha_rnd_end();
+      return err;
+    }
+  }
   ctx->add_to_stats(p.acc);
 
-  auto result= new (thd->mem_root) Search_context(&candidates, ctx, target);
+  auto result= new (thd->mem_root) Search_context(&candidates, ctx, target,
+                                                  p.filter);
   graph->context= result;
 
   return mhnsw_read_next(table);
@@ -1633,9 +1735,20 @@ int mhnsw_read_next(TABLE *table)
 
   float new_threshold= result->found.links[result->found.num-1]->distance_to(result->target);
   MHNSW_param p(ctx, graph, 0);
+  p.filter= result->filter;
+  p.table= table;
   if (int err= search_layer(&p, result->target, result->threshold,
                             static_cast<uint>(result->pos), &result->found, false))
     return err;
+  if (p.filter_gave_up)
+  {
+    /* continue without the filter, the SQL layer checks every row anyway */
+    p.filter= result->filter= nullptr;
+    if (int err= search_layer(&p, result->target, result->threshold,
+                              static_cast<uint>(result->pos), &result->found,
+                              false))
+      return err;
+  }
   result->pos= 0;
   result->threshold= new_threshold + FLT_EPSILON;
   return mhnsw_read_next(table);
@@ -21,7 +21,11 @@
 
 PSI_memory_key csv_key_memory_Transparent_file;
 
-Transparent_file::Transparent_file() : lower_bound(0), buff_size(IO_SIZE)
+/*
+  The buffer is refilled on every window miss of get_value(), so it
+  should cover many rows of a sequential scan.
+*/
+Transparent_file::Transparent_file() : lower_bound(0), buff_size(16*IO_SIZE)
 { 
   buff= (uchar *) my_malloc(csv_key_memory_Transparent_file,
                             buff_size*sizeof(uchar),  MYF(MY_WME));
@@ -80,14 +84,11 @@ my_off_t Transparent_file::read_next()
 }
 
 
-char Transparent_file::get_value(my_off_t offset)
+/* Read the window that starts at offset and return its first byte */
+char Transparent_file::refill(my_off_t offset)
 {
   size_t bytes_read;
 
-  /* check boundaries */
-  if ((lower_bound <= offset) && (((my_off_t) offset) < upper_bound))
-    return buff[offset - lower_bound];
-
   mysql_file_seek(filedes, offset, MY_SEEK_SET, MYF(0));
   /* read appropriate portion of the file */
   if ((bytes_read= mysql_file_read(filedes, buff, buff_size,
@@ -29,6 +29,8 @@ class Transparent_file
   my_off_t upper_bound;
   uint buff_size;
 
+  char refill(my_off_t offset);
+
 public:
 
   Transparent_file();
@@ -38,6 +40,11 @@ class Transparent_file
   uchar *ptr();
   my_off_t start();
   my_off_t end();
-  char get_value (my_off_t offset);
+  char get_value(my_off_t offset)
+  {
+    if (lower_bound <= offset && offset < upper_bound)
+      return buff[offset - lower_bound];
+    return refill(offset);
+  }
   my_off_t read_next();
 };
@@ -496,6 +496,8 @@ btr_page_create(
 				   level);
     mtr->write<8,mtr_t::MAYBE_NOP>(*block, index_id, index->id);
   }
+
+  block->page.set_index_stats(buf_index_stats.find(index->id));
 }
 
 buf_block_t *
@@ -947,6 +949,8 @@ static void btr_root_page_init(buf_block_t *block, index_id_t index_id,
         *block, PAGE_HEADER + PAGE_LEVEL + block->page.frame, 0U);
     mtr->write<8,mtr_t::MAYBE_NOP>(*block, page_index_id, index_id);
   }
+
+  block->page.set_index_stats(buf_index_stats.find(index_id));
 }
 
 /** Create the root node for a new index tree.
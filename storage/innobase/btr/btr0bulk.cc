@@ -92,6 +92,9 @@ PageBulk::init()
 							+ new_page, m_level);
 			m_mtr.write<8>(*new_block, index_id, m_index->id);
 		}
+
+		new_block->page.set_index_stats(
+			buf_index_stats.find(m_index->id));
 	} else {
 		new_block = btr_block_get(*m_index, m_page_no, RW_X_LATCH,
 					  &m_mtr);
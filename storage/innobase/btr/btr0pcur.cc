@@ -533,7 +533,11 @@ btr_pcur_move_to_next_page(
 
 	const auto s = mtr->get_savepoint();
 	mtr->rollback_to_savepoint(s - 2, s - 1);
-	if (first_access) {
+	if (srv_read_ahead_scan_pages) {
+		buf_read_ahead_scan(cursor->read_ahead,
+				    next_block->page.id(),
+				    btr_page_get_next(next_page));
+	} else if (first_access) {
 		buf_read_ahead_linear(next_block->page.id());
 	}
 	return DB_SUCCESS;
@@ -593,6 +597,9 @@ btr_pcur_move_backward_from_page(
 			/* Release the right sibling. */
 			mtr->rollback_to_savepoint(0, 1);
 			block = left_block;
+			buf_read_ahead_scan(cursor->read_ahead,
+					    block->page.id(),
+					    btr_page_get_prev(block->page.frame));
 		}
 	}
 
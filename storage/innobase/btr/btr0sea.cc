@@ -85,6 +85,8 @@ inline ahi_node **btr_sea::hash_chain::search(UnaryPred u) noexcept
 inline void btr_sea::partition::init() noexcept
 {
   latch.SRW_LOCK_INIT(btr_search_latch_key);
+  n_modify_start.store(0, std::memory_order_relaxed);
+  n_modify_end.store(0, std::memory_order_relaxed);
   blocks_mutex.init();
   UT_LIST_INIT(blocks, &buf_page_t::list);
 }
@@ -138,10 +140,15 @@ inline bool btr_sea::partition::alloc(ulint hash_size) noexcept
   return table.create(hash_size);
 }
 
+thread_local unsigned btr_sea::tls_lookup_stripe;
+
 void btr_sea::create() noexcept
 {
   for (partition &part : parts)
     part.init();
+  for (lookup_stripe &s : lookups)
+    s.n.store(0, std::memory_order_relaxed);
+  next_lookup_stripe.store(0, std::memory_order_relaxed);
 }
 
 bool btr_sea::alloc(size_t hash_size) noexcept
@@ -398,6 +405,7 @@ ATTRIBUTE_COLD bool btr_sea::disable_and_lock() noexcept
   if (was_enabled)
   {
     enabled= false;
+    wait_for_lookups();
     btr_search_disable(dict_sys.table_LRU);
     btr_search_disable(dict_sys.table_non_LRU);
     dict_sys.unfreeze();
@@ -412,6 +420,15 @@ ATTRIBUTE_COLD bool btr_sea::disable_and_lock() noexcept
   return was_enabled;
 }
 
+ATTRIBUTE_COLD void btr_sea::wait_for_lookups() noexcept
+{
+  /* This pairs with the fetch_add() in btr_search_guess_optimistic() */
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (const lookup_stripe &s : lookups)
+    while (s.n.load(std::memory_order_acquire))
+      std::this_thread::yield();
+}
+
 ATTRIBUTE_COLD void btr_sea::unlock() noexcept
 {
   for (ulong i= 0; i < n_parts; i++)
@@ -442,7 +459,7 @@ ATTRIBUTE_COLD void btr_sea::enable(bool resize) noexcept
     parts[i].latch.wr_lock(SRW_LOCK_CALL);
 
   if (!parts[0].table.array)
-    enabled= alloc(n_cells);
+    enabled.store(alloc(n_cells), std::memory_order_release);
   else
     ut_ad(enabled);
 
@@ -457,7 +474,7 @@ ATTRIBUTE_COLD void btr_sea::resize(uint n_cells) noexcept
   ut_ad(!parts[0].table.array);
 
   if (was_enabled)
-    enabled= alloc(n_cells);
+    enabled.store(alloc(n_cells), std::memory_order_release);
 
   if (!was_enabled || enabled)
     this->n_cells= n_cells;
@@ -485,6 +502,7 @@ void btr_sea::partition::insert(uint32_t fold, const rec_t *rec) noexcept
   hash_chain &cell{table.cell_get(fold)};
   page_hash_latch &hash_lock{table.lock_get(cell)};
   hash_lock.lock();
+  modify_start();
 
   ahi_node **prev= cell.search([fold](const ahi_node *node)
   { return !node || node->fold == fold; });
@@ -506,6 +524,7 @@ void btr_sea::partition::insert(uint32_t fold, const rec_t *rec) noexcept
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
     node->rec= rec;
   unlock:
+    modify_end();
     hash_lock.unlock();
     return;
   }
@@ -938,6 +957,7 @@ btr_sea::partition::erase(hash_chain &cell, const rec_t *rec) noexcept
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
     buf_block_t *const node_block{node->block};
 #endif
+    modify_start();
     *prev= node->next;
     if (ex)
       block= cleanup_after_erase(node);
@@ -953,6 +973,7 @@ btr_sea::partition::erase(hash_chain &cell, const rec_t *rec) noexcept
       ut_a(node_block->n_pointers-- < MAX_N_POINTERS);
     }
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+    modify_end();
   }
 
   if (ex)
@@ -983,12 +1004,12 @@ btr_sea::partition::erase(hash_chain &cell, const rec_t *rec) noexcept
 __attribute__((nonnull))
 /** Looks for an element when we know the pointer to the data and
 updates the pointer to data if found.
-@param table     hash table
+@param part      adaptive hash index partition
 @param fold      folded value of the searched data
 @param data      pointer to the data
 @param new_data  new pointer to the data
 @return whether the element was found */
-static bool ha_search_and_update_if_found(btr_sea::hash_table *table,
+static bool ha_search_and_update_if_found(btr_sea::partition *part,
                                           uint32_t fold,
                                           const rec_t *data,
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
@@ -1002,13 +1023,14 @@ static bool ha_search_and_update_if_found(btr_sea::hash_table *table,
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
   ut_ad(btr_search.enabled);
 
-  btr_sea::hash_chain &cell{table->cell_get(fold)};
-  page_hash_latch &hash_lock{table->lock_get(cell)};
+  btr_sea::hash_chain &cell{part->table.cell_get(fold)};
+  page_hash_latch &hash_lock{part->table.lock_get(cell)};
   hash_lock.lock();
   ahi_node *node=
     cell.find([data](const ahi_node *node){ return node->rec == data; });
   if (node)
   {
+    part->modify_start();
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
     if (node->block != new_block)
     {
@@ -1018,14 +1040,15 @@ static bool ha_search_and_update_if_found(btr_sea::hash_table *table,
     }
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
     node->rec= new_data;
+    part->modify_end();
   }
   hash_lock.unlock();
   return node != nullptr;
 }
 
 #if !defined UNIV_AHI_DEBUG && !defined UNIV_DEBUG
-# define ha_search_and_update_if_found(table,fold,data,new_block,new_data) \
-  ha_search_and_update_if_found(table,fold,data,new_data)
+# define ha_search_and_update_if_found(part,fold,data,new_block,new_data) \
+  ha_search_and_update_if_found(part,fold,data,new_data)
 #endif
 
 /** Fold a prefix given as the number of fields of a tuple.
@@ -1082,6 +1105,110 @@ static uint32_t dtuple_fold(const dtuple_t *tuple, const btr_cur_t *cursor)
   return fold;
 }
 
+/** Outcome of btr_search_guess_optimistic() */
+enum btr_search_guess_t
+{
+  /** the record was found and its page latched */
+  AHI_GUESS_FOUND,
+  /** the adaptive hash index does not contain the key */
+  AHI_GUESS_NOT_FOUND,
+  /** the lookup must be retried while holding btr_sea::partition::latch */
+  AHI_GUESS_RETRY
+};
+
+/** Look up a record in the adaptive hash index without writing to
+btr_sea::partition::latch or the hash_table::lock_get(), which would
+be heavily contended between concurrent lookups. Any concurrent
+modification is detected by btr_sea::partition::n_modify_start,
+and btr_sea::lookups prevents the memory from being freed.
+@param index       B-tree index
+@param part        adaptive hash index partition of index
+@param fold        CRC-32C of the search key prefix
+@param latch_mode  BTR_SEARCH_LEAF or BTR_MODIFY_LEAF
+@param block       the latched block with the guessed record
+@param rec         the guessed record
+@return the outcome */
+TRANSACTIONAL_TARGET TPOOL_SUPPRESS_TSAN
+static btr_search_guess_t
+btr_search_guess_optimistic(const dict_index_t *index,
+                            btr_sea::partition &part, uint32_t fold,
+                            btr_latch_mode latch_mode,
+                            buf_block_t *&block, const rec_t *&rec) noexcept
+{
+  btr_search_guess_t status{AHI_GUESS_RETRY};
+  btr_sea::lookup_stripe &lookup{btr_search.get_lookup_stripe()};
+  /* This pairs with the fence in btr_sea::wait_for_lookups()
+  and with the release store in btr_sea::enable() */
+  lookup.n.fetch_add(1);
+
+  if (btr_search.enabled.load(std::memory_order_seq_cst))
+  {
+    /* This pairs with btr_sea::partition::modify_end() */
+    const uint32_t end{part.n_modify_end.load(std::memory_order_acquire)};
+    const uint32_t start{part.n_modify_start.load(std::memory_order_acquire)};
+    if (start != end)
+      goto func_exit;
+
+    const ahi_node *node{part.table.cell_get(fold).first};
+    for (unsigned n= 0; node; node= node->next)
+    {
+      /* A concurrently freed node could contain garbage. */
+      if (!buf_pool.is_uncompressed_current(node) ||
+          uintptr_t(node) % alignof(ahi_node) || ++n > 64)
+        goto func_exit;
+      if (node->fold == fold)
+        break;
+    }
+
+    const rec_t *const r{node ? node->rec : nullptr};
+    /* This pairs with btr_sea::partition::modify_start() */
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (part.n_modify_start.load(std::memory_order_relaxed) != start)
+      goto func_exit;
+    if (!r)
+    {
+      status= AHI_GUESS_NOT_FOUND;
+      goto func_exit;
+    }
+
+    buf_block_t *const b{buf_pool.block_from(r)};
+    {
+      const page_id_t id{b->page.id()};
+      buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(id.fold());
+      /* Like in btr_search_guess_on_hash(), we must hold the cell
+      latch while attempting to acquire block->page.lock. */
+      transactional_shared_lock_guard<page_hash_latch> g
+        {buf_pool.page_hash.lock_get(chain)};
+      if (b->page.id() != id ||
+          part.n_modify_start.load(std::memory_order_acquire) != start ||
+          (latch_mode == BTR_SEARCH_LEAF
+           ? !b->page.lock.s_lock_try()
+           : !b->page.lock.x_lock_try()))
+        goto func_exit;
+    }
+
+    /* The node may have been removed and the page modified after we
+    validated the node but before we acquired the page latch. */
+    if (part.n_modify_start.load(std::memory_order_acquire) != start ||
+        b->page.state() < buf_page_t::UNFIXED || b->index != index)
+    {
+      if (latch_mode == BTR_SEARCH_LEAF)
+        b->page.lock.s_unlock();
+      else
+        b->page.lock.x_unlock();
+      goto func_exit;
+    }
+
+    block= b;
+    rec= r;
+    status= AHI_GUESS_FOUND;
+  }
+
+func_exit:
+  lookup.n.fetch_sub(1, std::memory_order_release);
+  return status;
+}
+
 /** Tries to guess the right search position based on the hash search info
 of the index. Note that if mode is PAGE_CUR_LE, which is used in inserts,
 and the function returns TRUE, then cursor->up_match and cursor->low_match
@@ -1140,6 +1267,20 @@ btr_search_guess_on_hash(
   cursor->fold= fold;
   btr_sea::partition &part= btr_search.get_part(*index);
   page_hash_latch *hash_lock= nullptr;
+  buf_block_t *block;
+  const rec_t *rec;
+
+  switch (btr_search_guess_optimistic(index, part, fold, latch_mode,
+                                      block, rec)) {
+  case AHI_GUESS_FOUND:
+    goto got_block;
+  case AHI_GUESS_NOT_FOUND:
+    cursor->flag= BTR_CUR_HASH_FAIL;
+    goto fail;
+  case AHI_GUESS_RETRY:
+    break;
+  }
+
   part.latch.rd_lock(SRW_LOCK_CALL);
 
   if (!btr_search.enabled)
@@ -1159,24 +1300,26 @@ btr_search_guess_on_hash(
     return false;
   }
 
-  btr_sea::hash_chain &cell{part.table.cell_get(fold)};
-  hash_lock= &part.table.lock_get(cell);
-  hash_lock->lock();
-  const ahi_node *node=
-    cell.find([fold](const ahi_node* node){ return node->fold == fold; });
-
-  if (!node)
   {
-    cursor->flag= BTR_CUR_HASH_FAIL;
-    goto ahi_release_and_fail;
-  }
+    btr_sea::hash_chain &cell{part.table.cell_get(fold)};
+    hash_lock= &part.table.lock_get(cell);
+    hash_lock->lock();
+    const ahi_node *node=
+      cell.find([fold](const ahi_node* node){ return node->fold == fold; });
 
-  const rec_t *rec= node->rec;
-  buf_block_t* block = buf_pool.block_from(rec);
-  ut_ad(block->page.frame == page_align(rec));
+    if (!node)
+    {
+      cursor->flag= BTR_CUR_HASH_FAIL;
+      goto ahi_release_and_fail;
+    }
+
+    rec= node->rec;
+    block= buf_pool.block_from(rec);
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
-  ut_a(block == node->block);
+    ut_a(block == node->block);
 #endif
+  }
+  ut_ad(block->page.frame == page_align(rec));
   {
     buf_pool_t::hash_chain &chain=
       buf_pool.page_hash.cell_get(block->page.id().fold());
@@ -1191,28 +1334,30 @@ btr_search_guess_on_hash(
       goto ahi_release_and_fail;
   }
 
-  const uint32_t state{block->page.state()};
-
-  if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED))
   {
-    ut_ad(state == buf_page_t::REMOVE_HASH);
-  block_and_ahi_release_and_fail:
-    if (latch_mode == BTR_SEARCH_LEAF)
-      block->page.lock.s_unlock();
-    else
-      block->page.lock.x_unlock();
-    cursor->flag= BTR_CUR_HASH_FAIL;
-    goto ahi_release_and_fail;
-  }
+    const uint32_t state{block->page.state()};
 
-  ut_ad(!block->page.is_read_fixed(state));
-  ut_ad(!block->page.is_write_fixed(state) || latch_mode == BTR_SEARCH_LEAF);
+    if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED))
+    {
+      ut_ad(state == buf_page_t::REMOVE_HASH);
+    block_and_ahi_release_and_fail:
+      if (latch_mode == BTR_SEARCH_LEAF)
+        block->page.lock.s_unlock();
+      else
+        block->page.lock.x_unlock();
+      cursor->flag= BTR_CUR_HASH_FAIL;
+      goto ahi_release_and_fail;
+    }
 
-  const dict_index_t *block_index= block->index;
-  if (index != block_index && index_id == block_index->id)
-  {
-    ut_a(block_index->freed());
-    goto block_and_ahi_release_and_fail;
+    ut_ad(!block->page.is_read_fixed(state));
+    ut_ad(!block->page.is_write_fixed(state) || latch_mode == BTR_SEARCH_LEAF);
+
+    const dict_index_t *block_index= block->index;
+    if (index != block_index && index_id == block_index->id)
+    {
+      ut_a(block_index->freed());
+      goto block_and_ahi_release_and_fail;
+    }
   }
 
   /* We successfully validated the state of the block and that it
@@ -1224,6 +1369,8 @@ btr_search_guess_on_hash(
   ut_d(hash_lock= reinterpret_cast<page_hash_latch*>(-1));
   part.latch.rd_unlock();
 
+got_block:
+  ut_ad(block->page.frame == page_align(rec));
   if (mtr->trx)
     buf_inc_get(mtr->trx);
 
@@ -1420,6 +1567,7 @@ static void btr_search_drop_page_hash_index(buf_block_t *block,
     ut_ad(block->ahi_left_bytes_fields == left_bytes_fields);
 
   MONITOR_INC_VALUE(MONITOR_ADAPTIVE_HASH_ROW_REMOVED, n_folds);
+  part.modify_start();
 
   while (n_folds)
   {
@@ -1451,6 +1599,8 @@ static void btr_search_drop_page_hash_index(buf_block_t *block,
     { return page_align(node->rec) == page; }));
   }
 
+  part.modify_end();
+
   if (!rec);
   else if (page_is_comp(page))
   {
@@ -1900,7 +2050,7 @@ void btr_search_update_hash_on_insert(btr_cur_t *cursor, bool reorg) noexcept
       in each INSERT. Therefore, we may fail to find the old rec
       (and fail to update the AHI to point to to our ins_rec). */
       if (ins_rec &&
-          ha_search_and_update_if_found(&part.table,
+          ha_search_and_update_if_found(&part,
                                         cursor->fold, rec, block, ins_rec))
       {
         MONITOR_INC(MONITOR_ADAPTIVE_HASH_ROW_UPDATED);
@@ -67,6 +67,7 @@ using st_::span;
 #ifdef HAVE_LIBNUMA
 #include <numa.h>
 #include <numaif.h>
+#include <sched.h>
 struct set_numa_interleave_t
 {
 	set_numa_interleave_t()
@@ -388,6 +389,83 @@ const byte *field_ref_zero;
 /** The InnoDB buffer pool */
 buf_pool_t buf_pool;
 
+my_bool innodb_buffer_pool_index_stats;
+
+buf_index_stats_t buf_index_stats;
+
+uint16_t buf_index_stats_t::find(index_id_t id) noexcept
+{
+  if (!id || id == DROPPED || !innodb_buffer_pool_index_stats)
+    return 0;
+  /* Fibonacci hashing; slot 0 is never used for an index */
+  const size_t start= size_t((id * 0x9E3779B97F4A7C15ULL) >> (64 - 12));
+  static_assert(N_SLOTS == 1U << 12, "compatibility");
+  size_t s= start;
+  /* Released slots are not emptied, so an index may follow them */
+  for (size_t i= N_PROBES; i--; s= (s + 1) & (N_SLOTS - 1))
+  {
+    if (!s)
+      continue;
+    const index_id_t found= slots[s].id.load(std::memory_order_relaxed);
+    if (found == id)
+      return uint16_t(s);
+    if (!found)
+      break;
+  }
+  s= start;
+  for (size_t i= N_PROBES; i--; s= (s + 1) & (N_SLOTS - 1))
+  {
+    if (!s)
+      continue;
+    index_id_t found= slots[s].id.load(std::memory_order_relaxed);
+    if (found == id)
+      return uint16_t(s);
+    if (found == DROPPED && !slots[s].pages && !slots[s].dirty)
+    {
+      if (slots[s].id.compare_exchange_strong(found, id,
+                                              std::memory_order_relaxed))
+      {
+        reset(s);
+        return uint16_t(s);
+      }
+    }
+    else if (!found &&
+             (slots[s].id.compare_exchange_strong(found, id,
+                                                  std::memory_order_relaxed) ||
+              found == id))
+      return uint16_t(s);
+  }
+  return 0;
+}
+
+void buf_index_stats_t::release(index_id_t id) noexcept
+{
+  if (!id || id == DROPPED)
+    return;
+  size_t s= size_t((id * 0x9E3779B97F4A7C15ULL) >> (64 - 12));
+  for (size_t i= N_PROBES; i--; s= (s + 1) & (N_SLOTS - 1))
+  {
+    if (!s)
+      continue;
+    index_id_t found= slots[s].id.load(std::memory_order_relaxed);
+    if (found == id)
+    {
+      slots[s].id.compare_exchange_strong(found, DROPPED,
+                                          std::memory_order_relaxed);
+      return;
+    }
+    if (!found)
+      return;
+  }
+}
+
+void buf_page_t::set_index_stats(const byte *page) noexcept
+{
+  set_index_stats(fil_page_index_page_check(page)
+                  ? buf_index_stats.find(btr_page_get_index_id(page))
+                  : uint16_t{0});
+}
+
 #ifdef UNIV_DEBUG
 /** This is used to insert validation operations in execution
 in the debug version */
@@ -1035,6 +1113,14 @@ ATTRIBUTE_COLD void buf_mem_pressure_shutdown() noexcept
 }
 #endif
 
+void buf_pool_t::register_buffers(bool reg) const noexcept
+{
+  if (reg)
+    os_aio_register_buffers(memory, size_in_bytes);
+  else
+    os_aio_register_buffers(nullptr, 0);
+}
+
 #if defined __linux__ || !defined DBUG_OFF
 inline void buf_pool_t::garbage_collect() noexcept
 {
@@ -1073,6 +1159,8 @@ inline void buf_pool_t::garbage_collect() noexcept
 # ifdef BTR_CUR_HASH_ADAPT
   bool ahi_disabled= btr_search.disable();
 # endif /* BTR_CUR_HASH_ADAPT */
+  /* Registered (pinned) memory must not be decommitted by shrunk(). */
+  register_buffers(false);
   time_t start= time(nullptr);
   mysql_mutex_lock(&mutex);
 
@@ -1095,6 +1183,7 @@ inline void buf_pool_t::garbage_collect() noexcept
         btr_search.enable(true);
 # endif
       mysql_mutex_unlock(&mutex);
+      register_buffers(true);
       sql_print_information("InnoDB: Memory pressure event shrunk"
                             " innodb_buffer_pool_size=%zum (%zu pages)"
                             " from %zum (%zu pages)",
@@ -1121,6 +1210,7 @@ inline void buf_pool_t::garbage_collect() noexcept
   }
 
   mysql_mutex_unlock(&mutex);
+  register_buffers(true);
   sql_print_information("InnoDB: Memory pressure event failed to shrink"
                         " innodb_buffer_pool_size=%zum", old_size);
   ut_d(validate());
@@ -1259,11 +1349,106 @@ buf_block_t *buf_pool_t::get_nth_page(size_t pos) const noexcept
     (memory + block_descriptors_in_bytes(pos));
 }
 
+#ifdef HAVE_LIBNUMA
+/** Maximum number of buf_pool.free entries to skip when looking for
+a block that resides on the local NUMA node */
+static constexpr unsigned NUMA_FREE_SCAN_MAX= 64;
+
+unsigned buf_pool_t::numa_local_slice() const noexcept
+{
+  const int cpu= sched_getcpu();
+  return cpu >= 0 && unsigned(cpu) < numa.n_cpus ? numa.cpu_slice[cpu] : 0;
+}
+
+ATTRIBUTE_COLD void buf_pool_t::numa_partition_init() noexcept
+{
+  ut_ad(!numa.n_slices);
+  if (numa_available() < 0)
+  {
+    sql_print_warning("InnoDB: innodb_numa_partition is not supported"
+                      " by the operating system");
+    return;
+  }
+
+  unsigned nodes[64], n= 0;
+  struct bitmask *numa_mems_allowed= numa_get_mems_allowed();
+  MEM_MAKE_DEFINED(numa_mems_allowed, sizeof *numa_mems_allowed);
+  for (unsigned i= 0; i < numa_mems_allowed->size && n < array_elements(nodes);
+       i++)
+    if (numa_bitmask_isbitset(numa_mems_allowed, i))
+      nodes[n++]= i;
+
+  const size_t n_extents= size_in_bytes_max / innodb_buffer_pool_extent_size;
+  if (n < 2 || n_extents < n)
+  {
+    numa_bitmask_free(numa_mems_allowed);
+    sql_print_information("InnoDB: Not partitioning the buffer pool"
+                          " between NUMA nodes");
+    return;
+  }
+
+  const size_t extents_per_slice= (n_extents + n - 1) / n;
+  n= unsigned((n_extents + extents_per_slice - 1) / extents_per_slice);
+
+  for (unsigned s= 0; s < n; s++)
+  {
+    const size_t first= s * extents_per_slice;
+    const size_t len= std::min(extents_per_slice, n_extents - first) *
+      innodb_buffer_pool_extent_size;
+    numa_bitmask_clearall(numa_mems_allowed);
+    numa_bitmask_setbit(numa_mems_allowed, nodes[s]);
+    if (mbind(memory + first * innodb_buffer_pool_extent_size, len,
+              MPOL_PREFERRED, numa_mems_allowed->maskp,
+              numa_mems_allowed->size, MPOL_MF_MOVE))
+      sql_print_warning("InnoDB: Failed to set NUMA memory policy of"
+                        " buffer pool slice %u to node %u (error: %s).",
+                        s, nodes[s], strerror(errno));
+  }
+
+  numa_bitmask_free(numa_mems_allowed);
+
+  const int n_cpus= numa_num_configured_cpus();
+  numa.n_cpus= n_cpus > 0 ? unsigned(n_cpus) : 0;
+  numa.cpu_slice= static_cast<byte*>(ut_zalloc_nokey(numa.n_cpus + 1));
+  for (unsigned cpu= 0; cpu < numa.n_cpus; cpu++)
+  {
+    const int node= numa_node_of_cpu(int(cpu));
+    for (unsigned s= 0; s < n; s++)
+      if (int(nodes[s]) == node)
+        numa.cpu_slice[cpu]= byte(s);
+  }
+
+  numa.extents_per_slice= extents_per_slice;
+  numa.n_slices= n;
+  sql_print_information("InnoDB: Partitioned the buffer pool between"
+                        " %u NUMA nodes", n);
+}
+#endif /* HAVE_LIBNUMA */
+
+inline buf_page_t *buf_pool_t::free_first() const noexcept
+{
+  buf_page_t *b= UT_LIST_GET_FIRST(free);
+#ifdef HAVE_LIBNUMA
+  if (numa.n_slices && b)
+  {
+    /* Prefer a block whose frame resides on the NUMA node of the
+    current thread. The free list is not partitioned, and we only
+    look at a bounded number of entries while holding the mutex. */
+    const unsigned local= numa_local_slice();
+    unsigned n= NUMA_FREE_SCAN_MAX;
+    for (buf_page_t *f= b; f && n--; f= UT_LIST_GET_NEXT(list, f))
+      if (numa_slice(f) == local)
+        return f;
+  }
+#endif /* HAVE_LIBNUMA */
+  return b;
+}
+
 buf_block_t *buf_pool_t::allocate() noexcept
 {
   mysql_mutex_assert_owner(&mutex);
 
-  while (buf_page_t *b= UT_LIST_GET_FIRST(free))
+  while (buf_page_t *b= free_first())
   {
     ut_ad(b->in_free_list);
     ut_d(b->in_free_list = FALSE);
@@ -1371,13 +1556,28 @@ bool buf_pool_t::create() noexcept
 #ifdef _WIN32
     memory_unaligned= my_virtual_mem_reserve(&size);
 #else
-    memory_unaligned= my_large_virtual_alloc(&size);
+    memory_unaligned= my_large_virtual_alloc(&size, &large_page_size);
 #endif
   }
 
   if (!memory_unaligned)
     goto oom;
 
+#ifndef _WIN32
+  if (my_use_large_pages && !large_page_size &&
+      size_in_bytes_max > ut_calc_align(size_in_bytes_requested,
+                                        innodb_buffer_pool_extent_size))
+  {
+    /* The whole mapping was populated, and resizing will be refused.
+    Do not waste memory beyond innodb_buffer_pool_size. */
+    my_virtual_mem_release(memory_unaligned, size);
+    size_in_bytes_max= ut_calc_align(size_in_bytes_requested,
+                                     innodb_buffer_pool_extent_size);
+    size= size_in_bytes_max;
+    goto retry;
+  }
+#endif
+
   const size_t alignment_waste=
     ((~size_t(memory_unaligned) & (innodb_buffer_pool_extent_size - 1)) + 1) &
     (innodb_buffer_pool_extent_size - 1);
@@ -1415,7 +1615,19 @@ bool buf_pool_t::create() noexcept
     goto oom;
   }
 #else
-  update_malloc_size(actual_size, 0);
+  if (!large_page_size)
+    update_malloc_size(actual_size, 0);
+  else if (!my_large_virtual_commit(memory,
+                                    committed_end(actual_size) - memory))
+  {
+    my_virtual_mem_release(memory_unaligned, size_unaligned);
+    memory= nullptr;
+    memory_unaligned= nullptr;
+    goto oom;
+  }
+  else
+    sql_print_information("InnoDB: Committing innodb_buffer_pool_size"
+                          " in %zum large pages", large_page_size >> 20);
 #endif
 
 #ifdef HAVE_LIBNUMA
@@ -1431,8 +1643,12 @@ bool buf_pool_t::create() noexcept
                         " (error: %s).", strerror(errno));
     numa_bitmask_free(numa_mems_allowed);
   }
+  if (srv_numa_partition && !srv_numa_interleave)
+    numa_partition_init();
 #endif /* HAVE_LIBNUMA */
 
+  os_aio_register_buffers(memory, actual_size);
+
   n_blocks= get_n_blocks(actual_size);
   n_blocks_to_withdraw= 0;
   UT_LIST_INIT(free, &buf_page_t::list);
@@ -1588,7 +1804,11 @@ void buf_pool_t::close() noexcept
     owner= nullptr;
 #endif
     os_total_large_mem_allocated-= size;
+#ifndef _WIN32
+    my_virtual_mem_decommit(memory, committed_end(size) - memory);
+#else
     my_virtual_mem_decommit(memory, size);
+#endif
     my_virtual_mem_release(memory_unaligned, size_unaligned);
     memory= nullptr;
     memory_unaligned= nullptr;
@@ -1602,6 +1822,10 @@ void buf_pool_t::close() noexcept
   page_hash.free();
 
   io_buf.close();
+#ifdef HAVE_LIBNUMA
+  ut_free(numa.cpu_slice);
+  memset(&numa, 0, sizeof numa);
+#endif /* HAVE_LIBNUMA */
   aligned_free(const_cast<byte*>(field_ref_zero));
   field_ref_zero= nullptr;
 }
@@ -1898,7 +2122,10 @@ inline void buf_pool_t::shrunk(size_t size, size_t reduced) noexcept
   my_virtual_mem_decommit() may be zeroed out or preserve its original
   contents.  Try to catch any unintended reads outside page_guess(). */
   MEM_UNDEFINED(memory + size, size_in_bytes_max - size);
-# else
+  /* Any access to decommitted large pages could allocate a new huge
+  page, or fail with SIGBUS if none are available. */
+  if (large_page_size)
+# endif
   for (size_t n= page_hash.pad(page_hash.n_cells), i= 0; i < n;
        i+= page_hash.ELEMENTS_PER_LATCH + 1)
   {
@@ -1909,8 +2136,13 @@ inline void buf_pool_t::shrunk(size_t size, size_t reduced) noexcept
     guess before we invoke my_virtual_mem_decommit() below. */
     latch.unlock();
   }
-# endif
+#ifndef _WIN32
+  char *const end= committed_end(size);
+  if (const size_t decommit= committed_end(size + reduced) - end)
+    my_virtual_mem_decommit(end, decommit);
+#else
   my_virtual_mem_decommit(memory + size, reduced);
+#endif
 #ifdef UNIV_PFS_MEMORY
   PSI_MEMORY_CALL(memory_free)(mem_key_buf_buf_pool, reduced, owner);
 #endif
@@ -1920,13 +2152,19 @@ ATTRIBUTE_COLD void buf_pool_t::resize(size_t size, THD *thd) noexcept
 {
   ut_ad(this == &buf_pool);
   mysql_mutex_assert_owner(&LOCK_global_system_variables);
-  ut_ad(size <= size_in_bytes_max);
+#ifdef _WIN32
   if (my_use_large_pages)
+#else
+  /* Large pages can only be committed on demand if
+  my_large_virtual_alloc() reported their size. */
+  if (my_use_large_pages && !large_page_size)
+#endif
   {
     my_error(ER_VARIABLE_IS_READONLY, MYF(0), "InnoDB",
              "innodb_buffer_pool_size", "large_pages=0");
     return;
   }
+  ut_ad(size <= size_in_bytes_max);
 
   size_t n_blocks_new= get_n_blocks(size);
 
@@ -1968,14 +2206,26 @@ ATTRIBUTE_COLD void buf_pool_t::resize(size_t size, THD *thd) noexcept
 
   if (n_blocks_removed <= 0)
   {
-    if (!my_virtual_mem_commit(memory + old_size, size - old_size))
     {
-      mysql_mutex_unlock(&mutex);
-      sql_print_error("InnoDB: Cannot commit innodb_buffer_pool_size=%zum;"
-                      " retaining innodb_buffer_pool_size=%zum",
-                      size >> 20, old_size >> 20);
-      my_error(ER_OUT_OF_RESOURCES, MYF(0));
-      return;
+      /* This block is crossed by goto resized. */
+#ifndef _WIN32
+      char *const commit_start= committed_end(old_size);
+      const size_t commit_size= committed_end(size) - commit_start;
+      if (large_page_size
+          ? commit_size &&
+          !my_large_virtual_commit(commit_start, commit_size)
+          : !my_virtual_mem_commit(memory + old_size, size - old_size))
+#else
+      if (!my_virtual_mem_commit(memory + old_size, size - old_size))
+#endif
+      {
+        mysql_mutex_unlock(&mutex);
+        sql_print_error("InnoDB: Cannot commit innodb_buffer_pool_size=%zum;"
+                        " retaining innodb_buffer_pool_size=%zum",
+                        size >> 20, old_size >> 20);
+        my_error(ER_OUT_OF_RESOURCES, MYF(0));
+        return;
+      }
     }
 
     size_in_bytes_requested= size;
@@ -2600,6 +2850,8 @@ buf_block_t *buf_pool_t::page_fix(const page_id_t id,
         b->lock.s_unlock();
       }
 
+      buf_index_stats.hit(b->index_stats);
+
       if (UNIV_UNLIKELY(!b->frame))
       {
       unzip:
@@ -2627,6 +2879,7 @@ buf_block_t *buf_pool_t::page_fix(const page_id_t id,
     buf_block_t *block= buf_read_page(id, err, chain);
     if (!block)
       return nullptr;
+    buf_index_stats.miss(block->page.index_stats);
     buf_read_ahead_random(id);
     if (err)
     {
@@ -2656,14 +2909,17 @@ uint32_t buf_pool_t::page_guess(buf_block_t *b, page_hash_latch &latch,
   the shrunk() call, shrink() and buf_LRU_block_free_non_file_page()
   should guarantee that b->page.state() is equal to
   buf_page_t::NOT_USED (0) for all to-be-freed blocks. */
+  if (large_page_size &&
+      /* Reading decommitted large pages could crash with SIGBUS. */
+      UNIV_UNLIKELY(reinterpret_cast<char*>(b) >= memory + size_in_bytes))
 #else
   /* shrunk() made the memory inaccessible. */
   if (UNIV_UNLIKELY(reinterpret_cast<char*>(b) >= memory + size_in_bytes))
+#endif
   {
     latch.unlock_shared();
     return 0;
   }
-#endif
   /* This synchronizes with buf_page_t::init() */
   uint32_t state{b->page.zip.fix.load(std::memory_order_acquire)};
   const page_id_t block_id{b->page.id()};
@@ -2799,6 +3055,7 @@ buf_page_get_gen(
 		}
 
 		ut_d(if (!(++buf_dbg_counter % 5771)) buf_pool.validate());
+		buf_index_stats.miss(block->page.index_stats);
 		buf_read_ahead_random(page_id);
 		state = block->page.state();
 		goto not_read_fixed;
@@ -2858,6 +3115,7 @@ buf_page_get_gen(
 		}
 
 		ut_ad(block->page.id() == page_id);
+		buf_index_stats.hit(block->page.index_stats);
 
 		if (UNIV_LIKELY(state > buf_page_t::UNFIXED
 				&& block->page.frame)) {
@@ -2887,6 +3145,7 @@ buf_page_get_gen(
 
 		block->page.lock.s_unlock();
 	} else {
+		buf_index_stats.hit(block->page.index_stats);
 not_read_fixed:
 		ut_ad(state > buf_page_t::FREED);
 		ut_ad(state < buf_page_t::READ_FIX
@@ -3671,6 +3930,8 @@ dberr_t buf_page_t::read_complete(const fil_node_t &node,
     }
   }
 
+  set_index_stats(frame ? frame : read_frame);
+
   if (!recovery || !frame)
   {
     ut_d(auto f=) zip.fix.fetch_sub(READ_FIX - UNFIXED);
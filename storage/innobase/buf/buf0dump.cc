@@ -53,6 +53,46 @@ enum status_severity {
 
 #define SHUTTING_DOWN()	(srv_shutdown_state != SRV_SHUTDOWN_NONE)
 
+/** Number of heat levels that the pages of a dump are divided into.
+The dump file lists the pages in LRU order, most recently used first,
+so the heat level of a page is derived from its position in the file.
+The file format is the same "space,page" lines that older versions
+write and read. */
+static constexpr uint32_t BUF_DUMP_HEAT_LEVELS = 16;
+
+/** innodb_buffer_pool_dump_interval */
+uint srv_buf_pool_dump_interval;
+
+/** Timer for innodb_buffer_pool_dump_interval */
+static std::unique_ptr<tpool::timer> buf_dump_timer;
+
+/** A page in the buffer pool dump */
+struct buf_dump_entry
+{
+	/** page identifier */
+	page_id_t	id;
+	/** heat level, 0 (coldest) to BUF_DUMP_HEAT_LEVELS-1 */
+	byte		heat;
+
+	/** Order by descending heat, then by ascending page identifier */
+	bool operator<(const buf_dump_entry& other) const
+	{
+		return heat != other.heat ? heat > other.heat : id < other.id;
+	}
+};
+
+/** Determine the heat level of a page in a buffer pool dump.
+@param pos	position of the page in the dump file, 0 being the most
+		recently used
+@param n	number of pages that are being loaded
+@return heat level, BUF_DUMP_HEAT_LEVELS-1 being the hottest */
+static byte buf_load_heat(ulint pos, ulint n)
+{
+	const ulint l = std::min<ulint>(pos * BUF_DUMP_HEAT_LEVELS / n,
+					BUF_DUMP_HEAT_LEVELS - 1);
+	return byte(BUF_DUMP_HEAT_LEVELS - 1 - l);
+}
+
 /* Flags that tell the buffer pool dump/load thread which action should it
 take after being waked up. */
 static volatile bool	buf_dump_should_start;
@@ -326,6 +366,10 @@ buf_dump(
 		return;
 	}
 
+	/* The LRU list is ordered by recency, and only blocks that
+	were accessed again after innodb_old_blocks_time will have been
+	promoted to the young sublist. Write the pages in that order, so
+	that buf_load() can rank them by their position in the file. */
 	for (bpage = UT_LIST_GET_FIRST(buf_pool.LRU), j = 0;
 	     bpage != NULL && j < n_pages;
 	     bpage = UT_LIST_GET_NEXT(LRU, bpage)) {
@@ -429,7 +473,7 @@ buf_load()
 	char		full_filename[OS_FILE_MAX_PATH];
 	char		now[32];
 	FILE*		f;
-	page_id_t*	dump;
+	buf_dump_entry*	dump;
 	ulint		dump_n;
 	ulint		i;
 	uint32_t	space_id;
@@ -483,7 +527,7 @@ buf_load()
 	dump_n = std::min(dump_n, buf_pool.curr_size());
 
 	if (dump_n != 0) {
-		dump = static_cast<page_id_t*>(ut_malloc_nokey(
+		dump = static_cast<buf_dump_entry*>(ut_malloc_nokey(
 				dump_n * sizeof(*dump)));
 	} else {
 		fclose(f);
@@ -541,7 +585,8 @@ buf_load()
 			return;
 		}
 
-		dump[i] = page_id_t(space_id, page_no);
+		dump[i].id = page_id_t(space_id, page_no);
+		dump[i].heat = buf_load_heat(i, dump_n);
 	}
 
 	/* Set dump_n to the actual number of initialized elements,
@@ -561,11 +606,15 @@ buf_load()
 	}
 
 	if (!SHUTTING_DOWN()) {
+		/* Read the hottest pages first. Within each heat level,
+		read the pages in ascending order of page identifier, so
+		that adjacent pages are submitted back to back and the
+		lookups of each tablespace are amortized. */
 		std::sort(dump, dump + dump_n);
 		std::set<uint32_t> missing;
-		for (const page_id_t id : st_::span<const page_id_t>
+		for (const buf_dump_entry &e : st_::span<const buf_dump_entry>
 		       (dump, dump_n)) {
-			missing.emplace(id.space());
+			missing.emplace(e.id.space());
 		}
 		for (std::set<uint32_t>::iterator i = missing.begin();
 		     i != missing.end(); ) {
@@ -581,9 +630,10 @@ buf_load()
 	}
 
 	/* Avoid calling the expensive fil_space_t::get() for each
-	page within the same tablespace. dump[] is sorted by (space, page),
-	so all pages from a given tablespace are consecutive. */
-	uint32_t	cur_space_id = dump[0].space();
+	page within the same tablespace. dump[] is sorted by heat and
+	(space, page), so the pages from a given tablespace are mostly
+	consecutive. */
+	uint32_t	cur_space_id = dump[0].id.space();
 	fil_space_t*	space = fil_space_t::get(cur_space_id);
 
 	PSI_stage_progress*	pfs_stage_progress __attribute__((unused))
@@ -594,7 +644,8 @@ buf_load()
 	for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
 
 		/* space_id for this iteration of the loop */
-		const uint32_t this_space_id = dump[i].space();
+		const page_id_t id = dump[i].id;
+		const uint32_t this_space_id = id.space();
 
 		if (this_space_id >= SRV_SPACE_ID_UPPER_BOUND) {
 			continue;
@@ -611,7 +662,7 @@ buf_load()
 
 		/* JAN: TODO: As we use background page read below,
 		if tablespace is encrypted we cant use it. */
-		if (!space || dump[i].page_no() >= space->get_size() ||
+		if (!space || id.page_no() >= space->get_size() ||
 		    (space->crypt_data &&
 		     space->crypt_data->encryption != FIL_ENCRYPTION_OFF &&
 		     space->crypt_data->type != CRYPT_SCHEME_UNENCRYPTED)) {
@@ -625,7 +676,7 @@ buf_load()
 		}
 
 		space->reacquire();
-		buf_read_page_background(dump[i], space, nullptr);
+		buf_read_page_background(id, space, nullptr);
 
 		if (buf_load_abort_flag) {
 			if (space) {
@@ -750,12 +801,43 @@ static tpool::task_group tpool_group(1);
 static tpool::waitable_task buf_dump_load_task(buf_dump_load_func, &tpool_group);
 static bool load_dump_enabled;
 
+/** Invoked every innodb_buffer_pool_dump_interval seconds */
+static void buf_dump_timer_callback(void*)
+{
+  /* Do not replace a dump with the contents of a buffer pool that
+  has not been fully loaded from it yet. */
+  if (!SHUTTING_DOWN() && !srv_read_only_mode &&
+      !export_vars.innodb_buffer_pool_load_incomplete)
+    buf_dump_start();
+}
+
 /** Start async buffer pool load, if srv_buffer_pool_load_at_startup was set.*/
 void buf_load_at_startup()
 {
   load_dump_enabled= true;
   if (srv_buffer_pool_load_at_startup)
     buf_do_load_dump();
+  buf_dump_interval_update();
+}
+
+/** Apply a change of innodb_buffer_pool_dump_interval.
+In innodb_read_only mode, no periodic dumps are written. */
+void buf_dump_interval_update()
+{
+  if (!load_dump_enabled || srv_read_only_mode || SHUTTING_DOWN())
+    return;
+  const int interval= int(std::min(srv_buf_pool_dump_interval, 86400U)) *
+    1000;
+  if (!interval)
+    buf_dump_timer.reset();
+  else if (buf_dump_timer)
+    buf_dump_timer->set_time(interval, interval);
+  else
+  {
+    buf_dump_timer.reset(srv_thread_pool->create_timer
+                         (buf_dump_timer_callback));
+    buf_dump_timer->set_time(interval, interval);
+  }
 }
 
 static void buf_do_load_dump()
@@ -768,5 +850,6 @@ static void buf_do_load_dump()
 void buf_load_dump_end()
 {
   ut_ad(SHUTTING_DOWN());
+  buf_dump_timer.reset();
   buf_dump_load_task.wait();
 }
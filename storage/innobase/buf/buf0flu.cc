@@ -54,6 +54,132 @@ ulint buf_lru_freed_page_count;
 /** Flag indicating if the page_cleaner is in active state. */
 Atomic_relaxed<bool> buf_page_cleaner_is_active;
 
+/** innodb_flush_workers: number of tasks that page cleaner batches
+hand the page writes to; 0 if the batch submits the writes itself */
+uint innodb_flush_workers;
+/** innodb_flush_workers_partition */
+ulong innodb_flush_workers_partition;
+
+namespace
+{
+/** A task that applies the checksum, encryption and compression and
+submits the writes of the pages that a flush batch has write-fixed.
+Pages are assigned by tablespace id, so that each worker keeps writing
+to the same files and the writes to different files proceed in parallel. */
+struct buf_flush_worker
+{
+  /** a page that is waiting to be written */
+  struct item
+  {
+    buf_page_t *bpage;
+    fil_space_t *space;
+    uint32_t state;
+    lsn_t lsn;
+    /** filled in by buf_page_t::write_prepare() */
+    buf_page_t::prepared_write w;
+  };
+
+  /** Maximum number of pages that are prepared before their writes
+  are submitted. Each prepared page may hold a buf_pool.io_buf slot,
+  which will only be released when the write completes. */
+  static constexpr size_t CHUNK= 8;
+
+  /** protects queue */
+  std::mutex mutex;
+  /** pages waiting to be written */
+  std::vector<item> queue;
+  /** ensures that only one task is executing at a time */
+  tpool::task_group group{1};
+  /** the task that writes the queue */
+  tpool::waitable_task task{callback, this, &group};
+
+  /** Write all queued pages.
+  @param arg   the buf_flush_worker */
+  static void callback(void *arg) noexcept
+  {
+    buf_flush_worker *w= static_cast<buf_flush_worker*>(arg);
+    std::vector<item> batch;
+    for (;;)
+    {
+      {
+        std::lock_guard<std::mutex> lk{w->mutex};
+        if (w->queue.empty())
+          return;
+        batch.swap(w->queue);
+      }
+      /* First compute the checksums and encrypt or compress a chunk
+      of pages, and only then submit the writes, so that the CPU
+      intensive part runs back to back and the writes are submitted in
+      a burst that fills the doublewrite batch. */
+      for (auto i= batch.begin(), end= batch.end(); i != end; )
+      {
+        const auto chunk_end= i + std::min<size_t>(CHUNK, end - i);
+        for (auto j= i; j != chunk_end; j++)
+          j->bpage->write_prepare(j->space, &j->w);
+        for (; i != chunk_end; i++)
+          i->bpage->write_submit(i->space, i->state, i->lsn, i->w);
+      }
+      batch.clear();
+    }
+  }
+};
+
+/** Maximum value of innodb_flush_workers */
+constexpr uint BUF_FLUSH_WORKERS_MAX= 32;
+
+/** With innodb_flush_workers_partition=page, the number of adjacent pages
+that are assigned to the same worker, to keep the writes sequential */
+constexpr uint32_t FLUSH_WORKERS_PAGE_RUN= 64;
+
+/** The flush workers */
+buf_flush_worker buf_flush_workers[BUF_FLUSH_WORKERS_MAX];
+}
+
+/** @return the number of flush workers to use for a batch.
+innodb_flush_workers may be changed at any time, so a batch must read it
+only once and use the same value for all its pages. */
+static uint buf_flush_workers_n() noexcept
+{
+  return std::min<uint>(innodb_flush_workers, BUF_FLUSH_WORKERS_MAX);
+}
+
+/** Hand a write-fixed page to a flush worker.
+@param bpage   page to be written
+@param space   tablespace, with a reference held for the write
+@param s       state() before the page was write-fixed
+@param lsn     FIL_PAGE_LSN of the page
+@param n       number of flush workers, from buf_flush_workers_n() */
+static void buf_flush_worker_submit(buf_page_t *bpage, fil_space_t *space,
+                                    uint32_t s, lsn_t lsn, uint n) noexcept
+{
+  ut_ad(n);
+  ut_ad(n <= BUF_FLUSH_WORKERS_MAX);
+  buf_flush_worker &w= buf_flush_workers
+    [(innodb_flush_workers_partition == FLUSH_WORKERS_PARTITION_PAGE
+      ? bpage->id().page_no() / FLUSH_WORKERS_PAGE_RUN
+      : space->id) % n];
+  bool submit;
+  {
+    std::lock_guard<std::mutex> lk{w.mutex};
+    submit= w.queue.empty();
+    w.queue.emplace_back(buf_flush_worker::item{bpage, space, s, lsn, {}});
+  }
+  if (submit)
+    srv_thread_pool->submit_task(&w.task);
+}
+
+/** Wait for the flush workers to submit all the writes that have been
+handed to them. This must be invoked before
+buf_dblwr.flush_buffered_writes(), so that no write remains stuck
+in a partially filled doublewrite batch. */
+static void buf_flush_workers_wait() noexcept
+{
+  mysql_mutex_assert_not_owner(&buf_pool.mutex);
+  mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
+  for (buf_flush_worker &w : buf_flush_workers)
+    w.task.wait();
+}
+
 /** Factor for scan length to determine n_pages for intended oldest LSN
 progress */
 static constexpr ulint buf_flush_lsn_scan_factor = 3;
@@ -67,6 +193,15 @@ static Atomic_relaxed<lsn_t> buf_flush_async_lsn;
 /** Target oldest_modification for the page cleaner furious flushing;
 writes are protected by buf_pool.flush_list_mutex */
 static Atomic_relaxed<lsn_t> buf_flush_sync_lsn;
+/** The latest checkpoint LSN for buf_flush_write_dirty_pages() */
+static Atomic_relaxed<lsn_t> buf_flush_dirty_pages_lsn;
+static void buf_flush_write_dirty_pages(void*) noexcept;
+/** innodb_log_checkpoint_dirty_pages task; disabled while the
+page cleaner is not running */
+static tpool::task_group buf_flush_dirty_pages_group(1);
+static tpool::waitable_task
+buf_flush_dirty_pages_task(buf_flush_write_dirty_pages, nullptr,
+                           &buf_flush_dirty_pages_group);
 
 #ifdef UNIV_PFS_THREAD
 mysql_pfs_key_t page_cleaner_thread_key;
@@ -168,6 +303,8 @@ void buf_pool_t::delete_from_flush_list(buf_page_t *bpage) noexcept
   flush_hp.adjust(bpage);
   UT_LIST_REMOVE(flush_list, bpage);
   flush_list_bytes-= bpage->physical_size();
+  if (bpage->oldest_modification() > 2)
+    buf_index_stats.dirty_dec(bpage->index_stats);
   bpage->clear_oldest_modification();
 #ifdef UNIV_DEBUG
   buf_flush_validate_skip();
@@ -293,6 +430,8 @@ void buf_page_t::write_complete(bool persistent, bool error, uint32_t state)
     oldest_modification_acquire() will observe the block as
     being detached from buf_pool.flush_list, after reading the value 0. */
     oldest_modification_.store(persistent, std::memory_order_release);
+    if (persistent)
+      buf_index_stats.dirty_dec(index_stats);
   }
   zip.fix.fetch_sub((state >= WRITE_FIX_REINIT)
                     ? (WRITE_FIX_REINIT - UNFIXED)
@@ -728,8 +867,9 @@ ATTRIBUTE_COLD void buf_pool_t::release_freed_page(buf_page_t *bpage) noexcept
 
 /** Write a flushable page to a file or free a freeable block.
 @param space       tablespace
+@param n_workers   number of flush workers, or 0 to write the page here
 @return whether a page write was initiated and buf_pool.mutex released */
-bool buf_page_t::flush(fil_space_t *space) noexcept
+bool buf_page_t::flush(fil_space_t *space, uint n_workers) noexcept
 {
   mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
   ut_ad(in_file());
@@ -781,16 +921,34 @@ bool buf_page_t::flush(fil_space_t *space) noexcept
   buf_LRU_stat_inc_io();
   mysql_mutex_unlock(&buf_pool.mutex);
 
-  IORequest::Type type= IORequest::WRITE_ASYNC;
-
   /* Apart from the U-lock, this block will also be protected by
   is_write_fixed() and oldest_modification()>1.
   Thus, it cannot be relocated or removed. */
 
+  space->reacquire();
+
+  if (n_workers)
+    buf_flush_worker_submit(this, space, s, lsn, n_workers);
+  else
+    write_out(space, s, lsn);
+  return true;
+}
+
+void buf_page_t::write_out(fil_space_t *space, uint32_t s, lsn_t lsn) noexcept
+{
+  prepared_write w;
+  write_prepare(space, &w);
+  write_submit(space, s, lsn, w);
+}
+
+void buf_page_t::write_prepare(fil_space_t *space, prepared_write *w) noexcept
+{
+  ut_ad(is_write_fixed());
+  ut_ad(space->referenced());
+
+  IORequest::Type type= IORequest::WRITE_ASYNC;
   buf_block_t *block= reinterpret_cast<buf_block_t*>(this);
   page_t *write_frame= zip.data;
-
-  space->reacquire();
   size_t size;
 #if defined HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE || defined _WIN32
   size_t orig_size;
@@ -848,20 +1006,29 @@ bool buf_page_t::flush(fil_space_t *space) noexcept
     write_frame= page;
   }
 
+  w->frame= write_frame;
+  w->slot= slot;
+  w->size= size;
+  w->type= type;
+}
+
+void buf_page_t::write_submit(fil_space_t *space, uint32_t s, lsn_t lsn,
+                              const prepared_write &w) noexcept
+{
+  ut_ad(is_write_fixed());
   if ((s & LRU_MASK) == REINIT || !space->use_doublewrite())
   {
     if (!space->is_temporary() && !space->is_being_imported() &&
         lsn > log_sys.get_flushed_lsn())
       log_write_up_to(lsn, true);
     ut_ad(space->is_temporary() || !space->full_crc32() ||
-          !buf_page_is_corrupted(true, write_frame, space->flags));
-    space->io(IORequest{type, this, slot}, physical_offset(), size,
-              write_frame, this);
+          !buf_page_is_corrupted(true, w.frame, space->flags));
+    space->io(IORequest{w.type, this, w.slot}, physical_offset(), w.size,
+              w.frame, this);
   }
   else
-    buf_dblwr.add_to_batch(IORequest{this, slot, space->chain.start, type},
-                           size);
-  return true;
+    buf_dblwr.add_to_batch(IORequest{this, w.slot, space->chain.start,
+                                     w.type}, w.size);
 }
 
 /** Check whether a page can be flushed from the buf_pool.
@@ -1018,13 +1185,15 @@ and also write zeroes or punch the hole for the freed ranges of pages.
 @param contiguous  whether to consider contiguous areas of pages
 @param n_flushed   number of pages flushed so far in this batch
 @param n_to_flush  maximum number of pages we are allowed to flush
+@param n_workers   number of flush workers, or 0
 @return number of pages flushed */
 static ulint buf_flush_try_neighbors(fil_space_t *space,
                                      const page_id_t page_id,
                                      buf_page_t *bpage,
                                      bool contiguous,
                                      ulint n_flushed,
-                                     ulint n_to_flush) noexcept
+                                     ulint n_to_flush,
+                                     uint n_workers) noexcept
 {
   ut_ad(space->id == page_id.space());
   ut_ad(bpage->id() == page_id);
@@ -1083,7 +1252,7 @@ static ulint buf_flush_try_neighbors(fil_space_t *space,
         bpage= nullptr;
         ut_ad(b->oldest_modification() > 1);
       flush:
-        if (b->flush(space))
+        if (b->flush(space, n_workers))
         {
           ++count;
           continue;
@@ -1259,6 +1428,7 @@ static void buf_flush_LRU_list_batch(ulint max, flush_counters_t *n,
   page less than 5% of BP. */
   const size_t buf_lru_min_len=
     std::min((buf_pool.usable_size()) / 20 - 1, size_t{BUF_LRU_MIN_LEN});
+  const uint n_workers= buf_flush_workers_n();
 
   for (buf_page_t *bpage= UT_LIST_GET_LAST(buf_pool.LRU);
        bpage &&
@@ -1274,6 +1444,9 @@ static void buf_flush_LRU_list_batch(ulint max, flush_counters_t *n,
     ut_ad(state >= buf_page_t::FREED);
     ut_ad(bpage->in_LRU_list);
 
+    if (!to_withdraw && buf_LRU_second_chance(bpage))
+      continue;
+
     if (!bpage->oldest_modification())
     {
     evict:
@@ -1368,13 +1541,13 @@ static void buf_flush_LRU_list_batch(ulint max, flush_counters_t *n,
           UT_LIST_GET_LEN(buf_pool.free) * 2 >= free_limit)
         n->flushed+= buf_flush_try_neighbors(space, page_id, bpage,
                                              neighbors == 1,
-                                             n->flushed, max);
+                                             n->flushed, max, n_workers);
       else
       {
       flush:
         if (UNIV_UNLIKELY(to_withdraw != 0))
           to_withdraw= buf_flush_LRU_to_withdraw(to_withdraw, *bpage);
-        if (bpage->flush(space))
+        if (bpage->flush(space, n_workers))
           ++n->flushed;
         else
           continue;
@@ -1392,6 +1565,13 @@ static void buf_flush_LRU_list_batch(ulint max, flush_counters_t *n,
   if (space)
     space->release();
 
+  if (n_workers)
+  {
+    mysql_mutex_unlock(&buf_pool.mutex);
+    buf_flush_workers_wait();
+    mysql_mutex_lock(&buf_pool.mutex);
+  }
+
   if (scanned)
   {
     MONITOR_INC_VALUE_CUMULATIVE(MONITOR_LRU_BATCH_SCANNED,
@@ -1435,6 +1615,7 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn) noexcept
 
   const auto neighbors= UT_LIST_GET_LEN(buf_pool.LRU) < BUF_LRU_OLD_MIN_LEN
     ? 0 : buf_pool.flush_neighbors;
+  const uint n_workers= buf_flush_workers_n();
   fil_space_t *space= nullptr;
   uint32_t last_space_id= FIL_NULL;
   static_assert(FIL_NULL > SRV_TMP_SPACE_ID, "consistency");
@@ -1524,8 +1705,9 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn) noexcept
       {
         if (neighbors && space->is_rotational())
           count+= buf_flush_try_neighbors(space, page_id, bpage,
-                                          neighbors == 1, count, max_n);
-        else if (bpage->flush(space))
+                                          neighbors == 1, count, max_n,
+                                          n_workers);
+        else if (bpage->flush(space, n_workers))
           ++count;
         else
           continue;
@@ -1543,6 +1725,15 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn) noexcept
   if (space)
     space->release();
 
+  if (n_workers)
+  {
+    mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+    mysql_mutex_unlock(&buf_pool.mutex);
+    buf_flush_workers_wait();
+    mysql_mutex_lock(&buf_pool.mutex);
+    mysql_mutex_lock(&buf_pool.flush_list_mutex);
+  }
+
   if (scanned)
   {
     MONITOR_INC_VALUE_CUMULATIVE(MONITOR_FLUSH_BATCH_SCANNED,
@@ -1874,6 +2065,11 @@ inline void log_t::write_checkpoint(lsn_t end_lsn) noexcept
   next_checkpoint_no++;
   const lsn_t checkpoint_lsn{next_checkpoint_lsn};
   last_checkpoint_lsn= checkpoint_lsn;
+  if (srv_log_checkpoint_dirty_pages)
+  {
+    buf_flush_dirty_pages_lsn= checkpoint_lsn;
+    srv_thread_pool->submit_task(&buf_flush_dirty_pages_task);
+  }
 
   DBUG_PRINT("ib_log", ("checkpoint ended at " LSN_PF ", flushed to " LSN_PF,
                         checkpoint_lsn, get_flushed_lsn()));
@@ -1974,6 +2170,69 @@ inline void log_t::write_checkpoint(lsn_t end_lsn) noexcept
     buf_flush_ahead(end_lsn + 1, false);
 }
 
+/** Write the identifiers of the pages in buf_pool.flush_list to
+LOG_DIRTY_PAGES_FILE_NAME after a checkpoint, for reading the pages
+while crash recovery is parsing the log. This is executed in
+buf_flush_dirty_pages_task, so that neither the page cleaner nor the
+checkpoint will wait for the file to be written. */
+static void buf_flush_write_dirty_pages(void*) noexcept
+{
+  /** the checkpoint that LOG_DIRTY_PAGES_FILE_NAME was written for */
+  static lsn_t written_lsn;
+  const lsn_t checkpoint_lsn{buf_flush_dirty_pages_lsn};
+  const size_t max_pages= srv_log_checkpoint_dirty_pages;
+  if (!max_pages || checkpoint_lsn == written_lsn)
+    return;
+  written_lsn= checkpoint_lsn;
+
+  std::vector<page_id_t> pages;
+  mysql_mutex_lock(&buf_pool.flush_list_mutex);
+  pages.reserve(std::min<size_t>(max_pages,
+                                 UT_LIST_GET_LEN(buf_pool.flush_list)));
+  for (const buf_page_t *bpage= UT_LIST_GET_LAST(buf_pool.flush_list);
+       bpage && pages.size() < max_pages;
+       bpage= UT_LIST_GET_PREV(list, bpage))
+    /* Skip pages that have already been written. */
+    if (bpage->oldest_modification() > 1)
+      pages.emplace_back(bpage->id());
+  mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+  std::sort(pages.begin(), pages.end());
+
+  const std::string path{get_log_file_path(LOG_DIRTY_PAGES_FILE_NAME)};
+  const std::string tmp{path + ".incomplete"};
+  FILE *f= fopen(tmp.c_str(), "w" STR_O_CLOEXEC);
+  if (!f)
+    return;
+
+  bool ok= fprintf(f, LSN_PF "\n", checkpoint_lsn) > 0;
+  for (auto i= pages.begin(); ok && i != pages.end(); )
+  {
+    const uint32_t id= i->space();
+    fil_space_t *space= fil_space_t::get(id);
+    /* Only list single-file tablespaces, so that the page offset
+    can be computed from the page number. */
+    if (space && UT_LIST_GET_LEN(space->chain) != 1)
+    {
+      space->release();
+      space= nullptr;
+    }
+    if (space)
+    {
+      ok= fprintf(f, "@%u,%u,%s\n", id, space->physical_size(),
+                  UT_LIST_GET_FIRST(space->chain)->name) > 0;
+      space->release();
+    }
+    for (; i != pages.end() && i->space() == id; i++)
+      if (space && ok)
+        ok= fprintf(f, "%u,%u\n", id, i->page_no()) > 0;
+  }
+
+  if (fclose(f) || !ok || (unlink(path.c_str()) && errno != ENOENT) ||
+      rename(tmp.c_str(), path.c_str()))
+    sql_print_warning("InnoDB: Cannot write %s: %s", path.c_str(),
+                      strerror(errno));
+}
+
 /** Initiate a log checkpoint, discarding the start of the log.
 @param oldest_lsn   the checkpoint LSN
 @param end_lsn      log_sys.get_lsn()
@@ -2772,6 +3031,7 @@ static void buf_flush_page_cleaner() noexcept
   buf_page_cleaner_is_active= false;
   pthread_cond_broadcast(&buf_pool.done_flush_list);
   mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+  buf_flush_dirty_pages_task.disable();
 
   my_thread_end();
 
@@ -2803,6 +3063,7 @@ ATTRIBUTE_COLD void buf_flush_page_cleaner_init() noexcept
   buf_flush_async_lsn= 0;
   buf_flush_sync_lsn= 0;
   buf_page_cleaner_is_active= true;
+  buf_flush_dirty_pages_task.enable();
   std::thread(buf_flush_page_cleaner).detach();
 }
 
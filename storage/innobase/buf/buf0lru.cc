@@ -100,6 +100,9 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 uint	buf_LRU_old_threshold_ms;
 /* @} */
 
+/** innodb_lru_policy */
+ulong	buf_LRU_policy;
+
 /** Remove bpage from buf_pool.LRU and buf_pool.page_hash.
 
 If !bpage->frame && bpage->oldest_modification() <= 1,
@@ -235,6 +238,10 @@ static bool buf_LRU_free_from_common_LRU_list(ulint limit)
 		buf_page_t*	prev = UT_LIST_GET_PREV(LRU, bpage);
 		buf_pool.lru_scan_itr.set(prev);
 
+		if (buf_LRU_second_chance(bpage)) {
+			continue;
+		}
+
 		const auto accessed = bpage->is_accessed();
 
 		if (buf_LRU_free_page(bpage, true)) {
@@ -710,6 +717,15 @@ void buf_page_make_young(buf_page_t *bpage)
 
   ut_ad(bpage->in_file());
 
+  if (buf_LRU_policy == BUF_LRU_CLOCK)
+  {
+    /* Avoid acquiring buf_pool.mutex; buf_LRU_second_chance() will
+    move the block when it reaches the end of buf_pool.LRU. */
+    if (!bpage->referenced)
+      bpage->referenced= true;
+    return;
+  }
+
   mysql_mutex_lock(&buf_pool.mutex);
 
   if (UNIV_UNLIKELY(bpage->old))
@@ -721,6 +737,24 @@ void buf_page_make_young(buf_page_t *bpage)
   mysql_mutex_unlock(&buf_pool.mutex);
 }
 
+bool buf_LRU_second_chance(buf_page_t *bpage) noexcept
+{
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+  ut_ad(bpage->in_LRU_list);
+
+  if (!bpage->referenced || bpage->is_read_fixed())
+    return false;
+
+  bpage->referenced= false;
+
+  if (UNIV_LIKELY(bpage->old))
+    buf_pool.stat.n_pages_made_young++;
+
+  buf_LRU_remove_block(bpage);
+  buf_LRU_add_block(bpage, false);
+  return true;
+}
+
 bool buf_page_make_young_if_needed(buf_page_t *bpage)
 {
   const bool not_first{bpage->set_accessed()};
@@ -1094,6 +1128,12 @@ static bool buf_LRU_block_remove_hashed(buf_page_t *bpage, const page_id_t id,
 	buf_pool.page_hash.remove(chain, bpage);
 	page_hash_latch& hash_lock = buf_pool.page_hash.lock_get(chain);
 
+	if (zip || !bpage->zip.data || !bpage->frame) {
+		/* If !zip, buf_LRU_free_page() keeps the compressed
+		page in a copy of the descriptor. */
+		buf_index_stats.evict(bpage->index_stats);
+	}
+
 	if (UNIV_UNLIKELY(!bpage->frame)) {
 		ut_ad(!bpage->in_free_list);
 		ut_ad(!bpage->in_LRU_list);
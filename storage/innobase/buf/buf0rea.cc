@@ -775,6 +775,120 @@ ulint buf_read_ahead_linear(const page_id_t page_id) noexcept
   return buf_read_release_count(block, count);
 }
 
+ulint buf_read_ahead_scan(buf_read_ahead_scan_t &state, const page_id_t page_id,
+                          uint32_t sibling) noexcept
+{
+  const uint32_t page_no= page_id.page_no();
+  const int32_t stride= int32_t(page_no - state.last_page);
+
+  if (state.last_page == FIL_NULL)
+  {
+    state.moves= 0;
+    state.run= 0;
+    state.requested= FIL_NULL;
+  }
+  else
+  {
+    if (state.moves < 2)
+      state.moves++;
+    if (stride == state.stride)
+      state.run++;
+    else
+    {
+      state.stride= stride;
+      state.run= 0;
+      state.requested= FIL_NULL;
+    }
+  }
+
+  state.last_page= page_no;
+
+  const uint32_t n= srv_read_ahead_scan_pages;
+  if (!n || state.moves < 2 || page_id.space() >= SRV_TMP_SPACE_ID ||
+      sibling == FIL_NULL)
+    return 0;
+
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  uint32_t first= sibling, count= 1;
+  int32_t step= 0;
+
+  if (state.run && stride && int32_t(sibling - page_no) == stride)
+  {
+    /* At least three pages were visited by the same stride, and the
+    sibling page confirms that the pattern continues. */
+    step= stride;
+    uint32_t ahead= 0;
+    if (state.requested != FIL_NULL)
+    {
+      const int32_t d= int32_t(state.requested - page_no) / stride;
+      if (d > 0)
+        ahead= uint32_t(d);
+    }
+    if (ahead > n / 2)
+      /* Enough pages have already been requested. */
+      return 0;
+    if (ahead)
+      first= state.requested + uint32_t(stride);
+    count= n - ahead;
+  }
+  else if (sibling == state.requested)
+    return 0;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size() / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return 0;
+
+  buf_block_t *block= nullptr;
+  unsigned zip_size{space->zip_size()};
+  if (UNIV_LIKELY(!zip_size))
+  {
+  allocate_block:
+    if (UNIV_UNLIKELY(!(block= buf_read_acquire())))
+    {
+      space->release();
+      return 0;
+    }
+  }
+  else if (recv_recovery_is_on())
+  {
+    zip_size|= 1;
+    goto allocate_block;
+  }
+
+  const uint32_t last= space->last_page_number();
+  ulint n_read= 0;
+
+  for (page_id_t i{page_id.space(), first};
+       count-- && i.page_no() && i.page_no() <= last;
+       i.set_page_no(i.page_no() + uint32_t(step)))
+  {
+    if (space->is_stopping())
+      break;
+    state.requested= i.page_no();
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(i.fold());
+    space->reacquire();
+    if (reinterpret_cast<buf_page_t*>(-1) ==
+        buf_read_page_low(i, zip_size, nullptr, chain, space, block, nullptr))
+    {
+      n_read++;
+      ut_ad(!block);
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+          UNIV_UNLIKELY(!(block= buf_read_acquire())))
+        break;
+    }
+  }
+
+  space->release();
+  return buf_read_release_count(block, n_read);
+}
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
@@ -787,7 +901,10 @@ void buf_read_recover(fil_space_t *space, const page_id_t page_id,
   space->reacquire();
   const ulint zip_size= space->zip_size() | 1;
   buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(page_id.fold());
-  buf_block_t *block= buf_LRU_get_free_block(have_no_mutex);
+  buf_block_t *block= recv_prefetched(*space, page_id);
+  const bool prefetched= block != nullptr;
+  if (!prefetched)
+    block= buf_LRU_get_free_block(have_no_mutex);
 
   if (init_lsn)
   {
@@ -803,6 +920,25 @@ void buf_read_recover(fil_space_t *space, const page_id_t page_id,
                              UT_LIST_GET_FIRST(space->chain),
                              IORequest::READ_ASYNC}, init_lsn);
   }
+  else if (prefetched)
+  {
+    /* The page was read while the log was being parsed. */
+    ut_ad(zip_size == 1);
+    buf_page_t *bpage= buf_page_init_for_read(page_id, zip_size, chain, block);
+    const bool exist(uintptr_t(bpage) & 1);
+    bpage= reinterpret_cast<buf_page_t*>(uintptr_t(bpage) & ~uintptr_t{1});
+    if (exist)
+    {
+      bpage->unfix();
+      space->release();
+    }
+    else
+    {
+      buf_LRU_stat_inc_io();
+      IORequest{bpage, nullptr, UT_LIST_GET_FIRST(space->chain),
+                IORequest::READ_SYNC}.read_complete(0);
+    }
+  }
   else if (!buf_read_page_low(page_id, zip_size, nullptr, chain, space, block,
                               nullptr))
   fail:
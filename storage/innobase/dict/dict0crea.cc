@@ -884,6 +884,8 @@ uint32_t dict_drop_index_tree(btr_pcur_t *pcur, trx_t *trx, mtr_t *mtr)
   const uint32_t space_id= mach_read_from_4(p);
   ut_ad(root_page_no == FIL_NULL || space_id <= SRV_SPACE_ID_UPPER_BOUND);
 
+  buf_index_stats.release(mach_read_from_8(rec + 8));
+
   if (space_id && (type & DICT_CLUSTERED))
     return space_id;
 
@@ -36,6 +36,7 @@ Created Jan 06, 2010 Vasil Dimov
 #include "que0que.h"
 #include "scope.h"
 #include "debug_sync.h"
+#include "srv0srv.h"
 #ifdef WITH_WSREP
 # include <mysql/service_wsrep.h>
 #endif
@@ -741,58 +742,6 @@ btr_record_not_null_field_in_rec(
 	}
 }
 
-inline dberr_t
-btr_cur_t::open_random_leaf(rec_offs *&offsets, mem_heap_t *&heap, mtr_t &mtr)
-{
-  ut_ad(!index()->is_spatial());
-  ut_ad(!mtr.get_savepoint());
-
-  mtr_s_lock_index(index(), &mtr);
-
-  if (index()->page == FIL_NULL)
-    return DB_CORRUPTION;
-
-  dberr_t err;
-  auto offset= index()->page;
-  ulint height= ULINT_UNDEFINED;
-
-  while (buf_block_t *block=
-         btr_block_get(*index(), offset, RW_S_LATCH, &mtr, &err))
-  {
-    page_cur.block= block;
-
-    if (height == ULINT_UNDEFINED)
-    {
-      height= btr_page_get_level(block->page.frame);
-      if (height > BTR_MAX_LEVELS)
-        return DB_CORRUPTION;
-
-      if (height == 0)
-        goto got_leaf;
-    }
-
-    if (height == 0)
-    {
-      mtr.rollback_to_savepoint(0, mtr.get_savepoint() - 1);
-    got_leaf:
-      page_cur.rec= page_get_infimum_rec(block->page.frame);
-      return DB_SUCCESS;
-    }
-
-    height--;
-
-    page_cur_open_on_rnd_user_rec(&page_cur);
-
-    offsets= rec_get_offsets(page_cur.rec, page_cur.index, offsets, 0,
-                             ULINT_UNDEFINED, &heap);
-
-    /* Go to the child node */
-    offset= btr_node_ptr_get_child_page_no(page_cur.rec, offsets);
-  }
-
-  return err;
-}
-
 /** Estimated table level stats from sampled value.
 @param value sampled stats
 @param index index being sampled
@@ -2590,6 +2539,82 @@ static index_stats_t dict_stats_analyze_index(trx_t *trx, dict_index_t* index)
 	DBUG_RETURN(result);
 }
 
+/** Maximum number of srv_thread_pool tasks that help
+dict_stats_update_persistent() analyze the secondary indexes */
+static constexpr size_t DICT_STATS_MAX_HELPERS= 7;
+
+/** Secondary indexes that are being analyzed by multiple threads */
+struct dict_stats_pll_t
+{
+  /** the indexes to analyze */
+  const std::vector<dict_index_t*> &indexes;
+  /** the statistics of each index */
+  std::vector<index_stats_t> &stats;
+  /** the next index to analyze */
+  std::atomic<size_t> next{0};
+
+  dict_stats_pll_t(const std::vector<dict_index_t*> &indexes,
+                   std::vector<index_stats_t> &stats) :
+    indexes(indexes), stats(stats) {}
+
+  /** Analyze indexes until all of them have been claimed.
+  @param trx  transaction for page access accounting, or nullptr */
+  void run(trx_t *trx)
+  {
+    for (size_t i; (i= next.fetch_add(1, std::memory_order_relaxed)) <
+           indexes.size(); )
+      stats[i]= dict_stats_analyze_index(trx, indexes[i]);
+  }
+};
+
+/** srv_thread_pool task that helps to analyze secondary indexes
+@param arg  dict_stats_pll_t */
+static void dict_stats_pll_task(void *arg)
+{
+  static_cast<dict_stats_pll_t*>(arg)->run(nullptr);
+}
+
+/** Analyze the secondary indexes of a table. If there are several,
+they are analyzed concurrently by srv_thread_pool tasks and the
+calling thread.
+@param trx      transaction
+@param indexes  the indexes to analyze
+@return the statistics of each index */
+static std::vector<index_stats_t>
+dict_stats_analyze_indexes(trx_t *trx,
+                           const std::vector<dict_index_t*> &indexes)
+{
+  std::vector<index_stats_t> stats;
+  stats.reserve(indexes.size());
+  for (const dict_index_t *index : indexes)
+    stats.emplace_back(index->n_uniq);
+
+  dict_stats_pll_t pll{indexes, stats};
+  std::vector<tpool::waitable_task*> tasks;
+
+  if (indexes.size() > 1)
+  {
+    const size_t n_helpers= std::min(indexes.size() - 1,
+                                     DICT_STATS_MAX_HELPERS);
+    tasks.reserve(n_helpers);
+    for (size_t i= 0; i < n_helpers; i++)
+    {
+      tasks.push_back(new tpool::waitable_task(dict_stats_pll_task, &pll));
+      srv_thread_pool->submit_task(tasks.back());
+    }
+  }
+
+  pll.run(trx);
+
+  for (tpool::waitable_task *task : tasks)
+  {
+    task->wait();
+    delete task;
+  }
+
+  return stats;
+}
+
 dberr_t dict_stats_update_persistent(trx_t *trx, dict_table_t *table) noexcept
 {
 	dict_index_t*	index;
@@ -2649,6 +2674,8 @@ dberr_t dict_stats_update_persistent(trx_t *trx, dict_table_t *table) noexcept
 
 	table->stat_sum_of_other_index_sizes = 0;
 
+	std::vector<dict_index_t*> indexes;
+
 	for (index = dict_table_get_next_index(index);
 	     index != NULL;
 	     index = dict_table_get_next_index(index)) {
@@ -2659,30 +2686,36 @@ dberr_t dict_stats_update_persistent(trx_t *trx, dict_table_t *table) noexcept
 
 		dict_stats_empty_index(index);
 
-		if (dict_stats_should_ignore_index(index)) {
-			continue;
+		if (!dict_stats_should_ignore_index(index)) {
+			indexes.push_back(index);
 		}
+	}
+
+	table->stats_mutex_unlock();
+	const std::vector<index_stats_t> index_stats
+		= dict_stats_analyze_indexes(trx, indexes);
+	table->stats_mutex_lock();
 
-		table->stats_mutex_unlock();
-		stats = dict_stats_analyze_index(trx, index);
-		table->stats_mutex_lock();
+	for (size_t j = 0; j < indexes.size(); j++) {
+		index = indexes[j];
+		const index_stats_t& s = index_stats[j];
 
-		if (stats.is_bulk_operation()) {
+		if (s.is_bulk_operation()) {
 			table->stats_mutex_unlock();
 			dict_stats_empty_table(table);
 			return DB_SUCCESS_LOCKED_REC;
 		}
 
-		index->stat_index_size = stats.index_size;
-		index->stat_n_leaf_pages = stats.n_leaf_pages;
+		index->stat_index_size = s.index_size;
+		index->stat_n_leaf_pages = s.n_leaf_pages;
 
-		for (size_t i = 0; i < stats.stats.size(); ++i) {
+		for (size_t i = 0; i < s.stats.size(); ++i) {
 			index->stat_n_diff_key_vals[i]
-				= stats.stats[i].n_diff_key_vals;
+				= s.stats[i].n_diff_key_vals;
 			index->stat_n_sample_sizes[i]
-				= stats.stats[i].n_sample_sizes;
+				= s.stats[i].n_sample_sizes;
 			index->stat_n_non_null_key_vals[i]
-				= stats.stats[i].n_non_null_key_vals;
+				= s.stats[i].n_non_null_key_vals;
 		}
 
 		table->stat_sum_of_other_index_sizes
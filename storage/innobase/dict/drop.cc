@@ -259,11 +259,12 @@ void trx_t::commit(std::vector<pfs_os_file_t> &deleted)
     id= 0;
     mutex_unlock();
 
-    for (const auto &p : mod_tables)
+    for (auto &p : mod_tables)
     {
       if (p.second.is_dropped())
       {
         dict_table_t *table= p.first;
+        p.second.stop_modifying(table);
         dict_stats_recalc_pool_del(table->id, true);
         const fil_space_t *space= table->space;
         ut_ad(!p.second.is_aux_table() || purge_sys.must_wait_FTS());
@@ -307,6 +307,7 @@ fil_node_t* fil_space_t::add(const char* name, pfs_os_file_t handle,
 	node->space = this;
 
 	node->atomic_write = atomic_write;
+	node->rwf_atomic = false;
 
 	this->size += size;
 	UT_LIST_ADD_LAST(chain, node);
@@ -93,6 +93,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "row0log.h"
 #include "row0merge.h"
 #include "row0mysql.h"
+#include "row0pread.h"
 #include "row0quiesce.h"
 #include "row0sel.h"
 #include "row0upd.h"
@@ -315,6 +316,30 @@ This is the same as "myisam_stats_method_typelib" */
 static TYPELIB innodb_stats_method_typelib =
 			CREATE_TYPELIB_FOR(innodb_stats_method_names);
 
+/** Possible values for system variable "innodb_flush_workers_partition" */
+static const char* innodb_flush_workers_partition_names[] = {
+	"tablespace",	/* FLUSH_WORKERS_PARTITION_TABLESPACE */
+	"page",		/* FLUSH_WORKERS_PARTITION_PAGE */
+	NullS
+};
+
+/** Used to define an enumerate type of the system variable
+innodb_flush_workers_partition. */
+static TYPELIB innodb_flush_workers_partition_typelib =
+	CREATE_TYPELIB_FOR(innodb_flush_workers_partition_names);
+
+/** Possible values for system variable "innodb_lru_policy" */
+static const char* innodb_lru_policy_names[] = {
+	"midpoint",	/* BUF_LRU_MIDPOINT */
+	"clock",	/* BUF_LRU_CLOCK */
+	NullS
+};
+
+/** Used to define an enumerate type of the system variable
+innodb_lru_policy. */
+static TYPELIB innodb_lru_policy_typelib =
+	CREATE_TYPELIB_FOR(innodb_lru_policy_names);
+
 /** Possible values for system variable "innodb_linux_aio" */
 #ifdef __linux__
 const char* innodb_linux_aio_names[] = {
@@ -383,7 +408,7 @@ static ulong innodb_flush_method;
 
 /** Names of allowed values of innodb_doublewrite */
 static const char *innodb_doublewrite_names[]=
-  {"OFF", "ON", "fast", nullptr};
+  {"OFF", "ON", "fast", "log", nullptr};
 
 /** Enumeration of innodb_doublewrite */
 TYPELIB innodb_doublewrite_typelib=
@@ -877,6 +902,11 @@ static MYSQL_THDVAR_UINT(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
   "Timeout in seconds an InnoDB transaction may wait for a lock before being rolled back. The value 100000000 is infinite timeout",
   NULL, NULL, 50, 0, 100000000, 0);
 
+static MYSQL_THDVAR_UINT(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads for counting the rows of a table in"
+  " SELECT COUNT(*) (1=disable)",
+  NULL, NULL, 1, 1, 256, 0);
+
 static MYSQL_THDVAR_STR(ft_user_stopword_table,
   PLUGIN_VAR_OPCMDARG|PLUGIN_VAR_MEMALLOC,
   "User supplied stopword table name, effective in the session level",
@@ -1006,7 +1036,7 @@ static SHOW_VAR innodb_status_variables[]= {
   {"num_open_files", &fil_system.n_open, SHOW_SIZE_T},
   {"truncated_status_writes", &truncated_status_writes, SHOW_SIZE_T},
   {"available_undo_logs", &srv_available_undo_logs, SHOW_ULONG},
-  {"undo_truncations", &export_vars.innodb_undo_truncations, SHOW_ULONG},
+  {"undo_truncations", &export_vars.innodb_undo_truncations, SHOW_SIZE_T},
 
   /* Status variables for page compression */
   {"page_compression_saved",
@@ -3005,6 +3035,10 @@ ha_innobase::ha_innobase(
 			  | HA_CAN_SKIP_LOCKED
 		  ),
 	m_start_of_scan(),
+	m_sample_left(),
+	m_sample_block(),
+	m_sample_key(),
+	m_sample_key_size(),
         m_mysql_has_locked()
 {}
 
@@ -3622,7 +3656,10 @@ static int innodb_init_abort()
 static void innodb_buffer_pool_size_update(THD* thd,st_mysql_sys_var*,void*,
                                            const void *save) noexcept
 {
+  /* Registered (pinned) memory must not be decommitted by resize(). */
+  buf_pool.register_buffers(false);
   buf_pool.resize(*static_cast<const size_t*>(save), thd);
+  buf_pool.register_buffers(true);
 }
 
 static MYSQL_SYSVAR_SIZE_T(buffer_pool_size, buf_pool.size_in_bytes_requested,
@@ -3780,8 +3817,12 @@ static int innodb_init_params()
      1U << 20);
   size_t innodb_buffer_pool_size= buf_pool.size_in_bytes_requested;
 
-  /* With large pages, buffer pool can't grow or shrink. */
-  if (!buf_pool.size_in_bytes_max || my_use_large_pages ||
+  /* With large pages, buffer pool can't grow or shrink, unless
+  buf_pool_t::create() can commit them on demand. */
+  if (!buf_pool.size_in_bytes_max ||
+#ifndef __linux__
+      my_use_large_pages ||
+#endif
       innodb_buffer_pool_size > buf_pool.size_in_bytes_max)
     buf_pool.size_in_bytes_max= ut_calc_align(innodb_buffer_pool_size,
                                               innodb_buffer_pool_extent_size);
@@ -3942,6 +3983,9 @@ static int innodb_init_params()
     DBUG_RETURN(HA_ERR_INITIALIZATION);
   }
 
+  if (srv_log_archive_dir && !*srv_log_archive_dir)
+    srv_log_archive_dir= nullptr;
+
   /* Check that interdependent parameters have sane values. */
   if (srv_max_buf_pool_modified_pct < srv_max_dirty_pages_pct_lwm)
   {
@@ -4036,7 +4080,8 @@ static int innodb_init_params()
            IF_WIN(innodb_flush_method < 8 /* normal */, true))
   {
     /* O_DIRECT and similar settings do nothing */
-    if (innodb_flush_method == 5 /* O_DIRECT_NO_FSYNC */ && buf_dblwr.use)
+    if (innodb_flush_method == 5 /* O_DIRECT_NO_FSYNC */ &&
+        buf_dblwr.use == buf_dblwr.USE_YES)
       buf_dblwr.use= buf_dblwr.USE_FAST;
   }
 #ifdef O_DIRECT
@@ -4968,6 +5013,12 @@ ha_innobase::table_flags() const
 		flags|= HA_REQUIRE_PRIMARY_KEY;
 	}
 
+	/* Let opt_sum_query() invoke records() for SELECT COUNT(*). */
+	if (THDVAR(thd, parallel_read_threads) > 1
+	    && thd_sql_command(thd) == SQLCOM_SELECT) {
+		flags |= HA_HAS_RECORDS;
+	}
+
 	/* Need to use tx_isolation here since table flags is (also)
 	called before prebuilt is inited. */
 
@@ -5894,6 +5945,8 @@ ha_innobase::open(const char* name, int, uint)
 	}
 
 	m_prebuilt = row_create_prebuilt(ib_table, table->s->reclength);
+	m_sample_key = nullptr;
+	m_sample_key_size = 0;
 
 	m_prebuilt->default_rec = table->s->default_values;
 	ut_ad(m_prebuilt->default_rec);
@@ -9420,6 +9473,9 @@ ha_innobase::rnd_end(void)
 /*======================*/
 {
 	m_disable_rowid_filter = false;
+	if (!m_sample_pages.empty()) {
+		std::unordered_set<uint32_t>().swap(m_sample_pages);
+	}
 	return(index_end());
 }
 
@@ -9452,6 +9508,195 @@ ha_innobase::rnd_next(
 	DBUG_RETURN(error);
 }
 
+/** Position the cursor of a sample scan on the first record of a
+random leaf page of the clustered index.
+@param buf	buffer for the row, in MySQL format
+@return 0, HA_ERR_END_OF_FILE, or error number */
+int ha_innobase::sample_block(uchar *buf)
+{
+	dict_index_t*	index = m_prebuilt->index;
+	ut_ad(index->is_primary());
+
+	if (m_prebuilt->trx->state == TRX_STATE_ABORTED) {
+		return HA_ERR_ROLLBACK;
+	}
+
+	if (m_prebuilt->sql_stat_start) {
+		build_template(false);
+	}
+
+	const ulint	n_uniq = dict_index_get_n_unique(index);
+	rec_offs*	offsets = nullptr;
+	mem_heap_t*	heap = mem_heap_create(256);
+
+	/* A random leaf page may be empty, be followed by invisible
+	records only, or have been chosen already; give up after
+	some attempts. */
+	for (uint attempt = 0; attempt < 100; attempt++) {
+		mtr_t		mtr{m_prebuilt->trx};
+		btr_cur_t	cursor;
+		cursor.page_cur.index = index;
+		mtr.start();
+
+		dberr_t	err = cursor.open_random_leaf(offsets, heap, mtr);
+		const rec_t*	rec = nullptr;
+
+		if (err == DB_SUCCESS
+		    && m_sample_pages.emplace(btr_cur_get_block(&cursor)
+					      ->page.id().page_no()).second) {
+			do {
+				rec = page_cur_move_to_next(
+					&cursor.page_cur);
+			} while (rec && rec_is_metadata(rec, *index));
+
+			if (rec && page_rec_is_supremum(rec)) {
+				rec = nullptr;
+			}
+		}
+
+		if (!rec) {
+			mtr.commit();
+			if (err != DB_SUCCESS) {
+				mem_heap_free(heap);
+				return convert_error_code_to_mysql(
+					err, m_prebuilt->table->flags,
+					m_user_thd);
+			}
+			continue;
+		}
+
+		m_sample_block = page_get_n_recs(btr_cur_get_page(&cursor));
+
+		dtuple_t*	tuple = m_prebuilt->search_tuple;
+		dtuple_set_n_fields(tuple, n_uniq);
+		dict_index_copy_types(tuple, index, n_uniq);
+		rec_copy_prefix_to_dtuple(tuple, rec, index,
+					  index->n_core_fields, n_uniq, heap);
+		mtr.commit();
+
+		/* The search tuple must remain valid after heap is
+		freed. Copy the key to a buffer that is only reallocated
+		when it is too small, so that m_prebuilt->heap will not
+		grow with each sampled page. */
+		ulint	len = 0;
+		for (ulint i = 0; i < n_uniq; i++) {
+			const dfield_t*	dfield = dtuple_get_nth_field(tuple, i);
+			if (!dfield_is_null(dfield)) {
+				len += dfield_get_len(dfield);
+			}
+		}
+
+		if (len > m_sample_key_size) {
+			m_sample_key_size = std::max(len,
+						     2 * m_sample_key_size);
+			m_sample_key = static_cast<byte*>(
+				mem_heap_alloc(m_prebuilt->heap,
+					       m_sample_key_size));
+		}
+
+		byte*	key = m_sample_key;
+		for (ulint i = 0; i < n_uniq; i++) {
+			dfield_t*	dfield = dtuple_get_nth_field(tuple, i);
+			if (!dfield_is_null(dfield)
+			    && (len = dfield_get_len(dfield))) {
+				memcpy(key, dfield_get_data(dfield), len);
+				dfield_set_data(dfield, key, len);
+				key += len;
+			}
+		}
+
+		mariadb_set_stats temp(m_prebuilt->trx, handler_stats);
+		err = row_search_mvcc(buf, PAGE_CUR_GE, m_prebuilt, 0, 0);
+
+		switch (err) {
+		case DB_SUCCESS:
+			mem_heap_free(heap);
+			table->status = 0;
+			return 0;
+		case DB_RECORD_NOT_FOUND:
+		case DB_END_OF_INDEX:
+			mem_heap_empty(heap);
+			offsets = nullptr;
+			continue;
+		default:
+			mem_heap_free(heap);
+			table->status = STATUS_NOT_FOUND;
+			return convert_error_code_to_mysql(
+				err, m_prebuilt->table->flags, m_user_thd);
+		}
+	}
+
+	mem_heap_free(heap);
+	table->status = STATUS_NOT_FOUND;
+	return HA_ERR_END_OF_FILE;
+}
+
+/** Read the next row of a random sample of the table. If a small
+fraction of a large table is requested, return all rows of randomly
+chosen leaf pages of the clustered index instead of reading all pages.
+Each leaf page is chosen at most once. The rows of a page are adjacent
+in primary key order, so this is a cluster sample; see
+handler::sample_next().
+@param buf	buffer for the row, in MySQL format
+@param fraction	fraction of the rows to return
+@return 0, HA_ERR_END_OF_FILE, or error number */
+int ha_innobase::sample_next(uchar *buf, double fraction)
+{
+	/** minimum size of the clustered index for sampling pages */
+	static constexpr ulint MIN_LEAF_PAGES_FOR_SAMPLING = 1000;
+
+	if (m_start_of_scan) {
+		const dict_index_t* index = m_prebuilt->index;
+		if (fraction > 0.5 || !index->is_primary()
+		    || !m_prebuilt->table->stat_initialized()
+		    || !m_prebuilt->table->is_readable()
+		    || index->stat_n_leaf_pages
+		    < MIN_LEAF_PAGES_FOR_SAMPLING) {
+			m_sample_left = HA_POS_ERROR;
+		} else {
+			m_start_of_scan = false;
+			m_sample_pages.clear();
+			m_sample_left = ha_rows(
+				fraction * double(
+					m_prebuilt->table->stat_n_rows)) + 1;
+			m_sample_block = 0;
+		}
+	}
+
+	if (m_sample_left == HA_POS_ERROR) {
+		return handler::sample_next(buf, fraction);
+	}
+
+	if (!m_sample_left) {
+		table->status = STATUS_NOT_FOUND;
+		return HA_ERR_END_OF_FILE;
+	}
+
+	int	error;
+
+	if (m_sample_block) {
+		error = general_fetch(buf, ROW_SEL_NEXT, 0);
+		if (error == HA_ERR_END_OF_FILE) {
+			error = sample_block(buf);
+		}
+	} else {
+		error = sample_block(buf);
+	}
+
+	if (!error) {
+		/* The row may have been read from a page after the
+		chosen one; do not choose that page later. */
+		m_sample_pages.emplace(
+			m_prebuilt->pcur->old_page_id.page_no());
+		m_sample_left--;
+		if (m_sample_block) {
+			m_sample_block--;
+		}
+	}
+
+	return error;
+}
+
 /**********************************************************************//**
 Fetches a row from the table based on a row reference.
 @return 0, HA_ERR_KEY_NOT_FOUND, or error code */
@@ -14446,6 +14691,66 @@ ha_innobase::estimate_rows_upper_bound()
 	DBUG_RETURN((ha_rows) estimate);
 }
 
+/*********************************************************************//**
+Counts the rows of the table in a consistent read, using
+innodb_parallel_read_threads scans of the clustered index, if
+table_flags() included HA_HAS_RECORDS, that is, for opt_sum_query().
+Other callers, such as the ALTER TABLE progress reporting or the
+sampling in collect_statistics_for_table(), get the estimate
+stats.records, like from handler::records().
+@return number of rows
+@retval HA_POS_ERROR if the rows must be counted by a table scan */
+
+ha_rows
+ha_innobase::records()
+/*===================*/
+{
+	DBUG_ENTER("ha_innobase::records");
+
+	if (!(table_flags() & HA_HAS_RECORDS)) {
+		DBUG_RETURN(stats.records);
+	}
+
+	update_thd(ha_thd());
+
+	const uint	n_threads = THDVAR(m_user_thd, parallel_read_threads);
+	dict_table_t*	table = m_prebuilt->table;
+	trx_t*		trx = m_prebuilt->trx;
+	dict_index_t*	index = dict_table_get_first_index(table);
+
+	/* Locking reads, READ UNCOMMITTED and tables without MVCC
+	must be handled by the normal table scan. */
+	if (n_threads <= 1
+	    || m_prebuilt->select_lock_type != LOCK_NONE
+	    || trx->isolation_level == TRX_ISO_READ_UNCOMMITTED
+	    || srv_read_only_mode
+	    || table->is_temporary() || table->no_rollback()
+	    || !table->is_readable() || !index->is_readable()
+	    || index->is_corrupted()) {
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	trx_start_if_not_started(trx, false);
+	trx->read_view.open(trx);
+
+	if (trx_id_t bulk_trx_id = table->bulk_trx_id) {
+		/* See row_search_mvcc() for a comment on bulk_trx_id */
+		if (!trx->read_view.changes_visible(bulk_trx_id)) {
+			DBUG_RETURN(0);
+		}
+	}
+
+	ulint	n_rows;
+
+	if (row_count_parallel(index, trx, n_threads, &n_rows)
+	    != DB_SUCCESS) {
+		/* Let the table scan report the error. */
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	DBUG_RETURN(n_rows);
+}
+
 
 /*********************************************************************//**
 How many seeks it will take to read through the table. This is to be
@@ -19082,7 +19387,10 @@ static MYSQL_SYSVAR_ENUM(doublewrite, buf_dblwr.use,
   "Whether and how to use the doublewrite buffer. "
   "OFF=Assume that writes of innodb_page_size are atomic; "
   "ON=Prevent torn writes (the default); "
-  "fast=Like ON, but do not synchronize writes to data files",
+  "fast=Like ON, but do not synchronize writes to data files; "
+  "log=Like ON, but write a full page image to the redo log when a page "
+  "is first modified after being written, and skip the doublewrite buffer "
+  "for such pages",
   nullptr, innodb_doublewrite_update, true,
   &innodb_doublewrite_typelib);
 
@@ -19144,6 +19452,18 @@ static MYSQL_SYSVAR_ULONG(purge_batch_size, srv_purge_batch_size,
   1,			/* Minimum value */
   innodb_purge_batch_size_MAX, 0);
 
+static MYSQL_SYSVAR_BOOL(purge_read_ahead, srv_purge_read_ahead,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether purge should read ahead the next undo log page"
+  " and the previous undo log in the history list",
+  NULL, NULL, TRUE);
+
+static MYSQL_SYSVAR_ULONG(undo_version_cache_size, srv_undo_version_cache_size,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Size of the cache of old record versions that were constructed"
+  " from undo logs for consistent reads, in bytes (0=disable)",
+  NULL, NULL, 0, 0, 1UL << 30, 0);
+
 extern void srv_update_purge_thread_count(uint n);
 
 static
@@ -19208,6 +19528,18 @@ static MYSQL_SYSVAR_STR(log_group_home_dir, srv_log_group_home_dir,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "Path to ib_logfile0", NULL, NULL, NULL);
 
+static MYSQL_SYSVAR_STR(log_archive_dir, srv_log_archive_dir,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Directory where each lap of the circular ib_logfile0 is copied to"
+  " (NULL=disable; implies innodb_log_file_mmap=OFF)",
+  NULL, NULL, NULL);
+
+static MYSQL_SYSVAR_ULONG(log_archive_files, srv_log_archive_files,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of files to keep in innodb_log_archive_dir;"
+  " the oldest ones are deleted when a new one is created (0=unlimited)",
+  nullptr, nullptr, 16, 0, 1UL << 20, 0);
+
 static MYSQL_SYSVAR_DOUBLE(max_dirty_pages_pct, srv_max_buf_pool_modified_pct,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of dirty pages allowed in bufferpool",
@@ -19255,6 +19587,22 @@ static MYSQL_SYSVAR_ULONG(max_purge_lag_delay, srv_max_purge_lag_delay,
    0L,			/* Minimum value */
    10000000UL, 0);	/* Maximum value */
 
+/** Update innodb_max_purge_lag_per_table. */
+static void innodb_max_purge_lag_per_table_update(THD *, st_mysql_sys_var *,
+                                                  void *, const void *save)
+{
+  srv_max_purge_lag_per_table= *static_cast<const my_bool*>(save);
+  /* Do not use the tables of an earlier setting if it is enabled again. */
+  if (!srv_max_purge_lag_per_table)
+    trx_purge_clear_lagging();
+}
+
+static MYSQL_SYSVAR_BOOL(max_purge_lag_per_table, srv_max_purge_lag_per_table,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether innodb_max_purge_lag should only delay DML on the tables"
+  " that contributed the most undo log records to the latest purge batch",
+  NULL, innodb_max_purge_lag_per_table_update, FALSE);
+
 static MYSQL_SYSVAR_UINT(max_purge_lag_wait, innodb_max_purge_lag_wait,
   PLUGIN_VAR_RQCMDARG,
   "Wait until History list length is below the specified limit",
@@ -19362,6 +19710,22 @@ static MYSQL_SYSVAR_BOOL(buffer_pool_dump_at_shutdown, srv_buffer_pool_dump_at_s
   "Dump the buffer pool into a file named @@innodb_buffer_pool_filename",
   NULL, NULL, TRUE);
 
+/** Update innodb_buffer_pool_dump_interval */
+static void innodb_buffer_pool_dump_interval_update(THD*,
+                                                    st_mysql_sys_var*,
+                                                    void*, const void *save)
+{
+  srv_buf_pool_dump_interval= *static_cast<const uint*>(save);
+  if (!srv_read_only_mode)
+    buf_dump_interval_update();
+}
+
+static MYSQL_SYSVAR_UINT(buffer_pool_dump_interval, srv_buf_pool_dump_interval,
+  PLUGIN_VAR_RQCMDARG,
+  "Seconds between periodic dumps of the buffer pool into a file named"
+  " @@innodb_buffer_pool_filename; 0 (default) disables periodic dumps",
+  NULL, innodb_buffer_pool_dump_interval_update, 0, 0, 86400, 0);
+
 static MYSQL_SYSVAR_ULONG(buffer_pool_dump_pct, srv_buf_pool_dump_pct,
   PLUGIN_VAR_RQCMDARG,
   "Dump only the hottest N% of each buffer pool, defaults to 25",
@@ -19385,6 +19749,13 @@ static MYSQL_SYSVAR_BOOL(buffer_pool_load_now, innodb_buffer_pool_load_now,
   "Trigger an immediate load of the buffer pool from a file named @@innodb_buffer_pool_filename",
   NULL, buffer_pool_load_now, FALSE);
 
+static MYSQL_SYSVAR_BOOL(buffer_pool_index_stats,
+  innodb_buffer_pool_index_stats,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether to collect the per-index statistics of"
+  " INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_BOOL(buffer_pool_load_abort, innodb_buffer_pool_load_abort,
   PLUGIN_VAR_RQCMDARG,
   "Abort a currently running load of the buffer pool",
@@ -19409,6 +19780,22 @@ static MYSQL_SYSVAR_ULONG(flush_neighbors, buf_pool.flush_neighbors,
   " when flushing a block",
   NULL, innodb_buf_pool_update<ulong>, 1, 0, 2, 0);
 
+static MYSQL_SYSVAR_UINT(flush_workers, innodb_flush_workers,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of tasks that write out the pages of a buffer pool flush batch,"
+  " partitioned by tablespace; 0 (default) makes the page cleaner"
+  " submit the writes itself",
+  NULL, NULL, 0, 0, 32, 0);
+
+static MYSQL_SYSVAR_ENUM(flush_workers_partition,
+  innodb_flush_workers_partition,
+  PLUGIN_VAR_RQCMDARG,
+  "How innodb_flush_workers are assigned pages to checksum, encrypt and"
+  " write: \"tablespace\" (default) or \"page\" to spread the pages of"
+  " a single tablespace over all workers",
+  NULL, NULL, FLUSH_WORKERS_PARTITION_TABLESPACE,
+  &innodb_flush_workers_partition_typelib);
+
 static MYSQL_SYSVAR_BOOL(deadlock_detect, innodb_deadlock_detect,
   PLUGIN_VAR_NOCMDARG,
   "Enable/disable InnoDB deadlock detector (default ON)."
@@ -19421,6 +19808,19 @@ static MYSQL_SYSVAR_ENUM(deadlock_report, innodb_deadlock_report,
   "How to report deadlocks (if innodb_deadlock_detect=ON)",
   NULL, NULL, Deadlock::REPORT_FULL, &innodb_deadlock_report_typelib);
 
+static MYSQL_SYSVAR_UINT(deadlock_check_depth, innodb_deadlock_check_depth,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of waits-for edges that are traversed when a lock wait"
+  " starts; longer paths are checked by the waiting thread after one second"
+  " (0=unlimited)",
+  NULL, NULL, 0, 0, UINT_MAX, 0);
+
+static MYSQL_SYSVAR_UINT(fetch_cache_rows, srv_fetch_cache_rows,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of rows that a table scan prefetches and converts"
+  " to the MariaDB row format in one batch",
+  NULL, NULL, 128, MYSQL_FETCH_CACHE_SIZE, 1024, 0);
+
 static MYSQL_SYSVAR_UINT(fill_factor, innobase_fill_factor,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of B-tree page filled during bulk insert",
@@ -19501,6 +19901,12 @@ static MYSQL_SYSVAR_ULONG(sort_buffer_size, srv_sort_buf_size,
   "Memory buffer size for index creation",
   NULL, NULL, 1048576, 65536, 64<<20, 0);
 
+static MYSQL_SYSVAR_ULONG(merge_sort_threads, srv_merge_sort_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of threads for merging the sorted runs of an index"
+  " that is being created",
+  NULL, NULL, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONGLONG(online_alter_log_max_size, srv_online_max_size,
   PLUGIN_VAR_RQCMDARG,
   "Maximum modification log file size for online index creation",
@@ -19545,6 +19951,12 @@ static MYSQL_SYSVAR_UINT(read_io_threads, srv_n_read_io_threads,
   "Number of background read I/O threads in InnoDB",
   NULL, innodb_read_io_threads_update , 4, 1, 64, 0);
 
+static MYSQL_SYSVAR_UINT(recovery_threads, srv_n_recovery_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Maximum number of threads that apply redo log to pages during"
+  " crash recovery (0=number of processors)",
+  NULL, NULL, 0, 0, 256, 0);
+
 static MYSQL_SYSVAR_UINT(write_io_threads, srv_n_write_io_threads,
   PLUGIN_VAR_RQCMDARG,
   "Number of background write I/O threads in InnoDB",
@@ -19603,6 +20015,20 @@ static MYSQL_SYSVAR_ULONGLONG(log_file_size, srv_log_file_size,
   nullptr, innodb_log_file_size_update,
   96 << 20, 4 << 20, std::numeric_limits<ulonglong>::max(), 4096);
 
+static MYSQL_SYSVAR_BOOL(log_compress, srv_log_compress,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether large writes to pages should be compressed in the redo log."
+  " Older server versions cannot recover such log",
+  nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_ULONG(log_checkpoint_dirty_pages,
+  srv_log_checkpoint_dirty_pages,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of dirty page identifiers to write to ib_dirty_pages"
+  " after each log checkpoint, for prefetching them on crash recovery"
+  " (0=disable)",
+  nullptr, nullptr, 0, 0, 1UL << 20, 0);
+
 static uint innodb_log_spin_wait_delay;
 
 static MYSQL_SYSVAR_UINT(log_spin_wait_delay, innodb_log_spin_wait_delay,
@@ -19622,6 +20048,14 @@ static MYSQL_SYSVAR_UINT(old_blocks_time, buf_LRU_old_threshold_ms,
   " The timeout is disabled if 0",
   NULL, NULL, 1000, 0, UINT_MAX32, 0);
 
+static MYSQL_SYSVAR_ENUM(lru_policy, buf_LRU_policy,
+  PLUGIN_VAR_RQCMDARG,
+  "How accessed blocks are moved to the 'new' end of the buffer pool:"
+  " \"midpoint\" (default) moves them immediately;"
+  " \"clock\" only flags them, without acquiring the buffer pool mutex,"
+  " and moves them when they would be evicted",
+  NULL, NULL, BUF_LRU_MIDPOINT, &innodb_lru_policy_typelib);
+
 static MYSQL_SYSVAR_ULONG(open_files, innobase_open_files,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "How many files at the maximum InnoDB keeps open at the same time",
@@ -19724,6 +20158,18 @@ static MYSQL_SYSVAR_ENUM(linux_aio, srv_linux_aio_method,
   " Possible value are \"auto\" (default) to select io_uring"
   " and fallback to aio, or explicit \"io_uring\" or \"aio\"",
   nullptr, nullptr, SRV_LINUX_AIO_AUTO, &innodb_linux_aio_typelib);
+
+static MYSQL_SYSVAR_BOOL(io_uring_sqpoll, srv_io_uring_sqpoll,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Whether io_uring should use a kernel thread for polling the"
+  " submission queue",
+  nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_BOOL(io_uring_fixed, srv_io_uring_fixed,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Whether the buffer pool and the data files should be registered"
+  " with io_uring",
+  nullptr, nullptr, FALSE);
 #endif
 
 #ifdef HAVE_LIBNUMA
@@ -19731,6 +20177,13 @@ static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Use NUMA interleave memory policy to allocate InnoDB buffer pool",
   NULL, NULL, FALSE);
+
+static MYSQL_SYSVAR_BOOL(numa_partition, srv_numa_partition,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Bind contiguous slices of the InnoDB buffer pool to NUMA nodes and"
+  " prefer allocating blocks from the node of the requesting thread;"
+  " ignored if innodb_numa_interleave=ON",
+  NULL, NULL, FALSE);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_ENUM(stats_method, srv_innodb_stats_method,
@@ -19759,6 +20212,12 @@ static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   " trigger a readahead",
   NULL, NULL, 56, 0, 64, 0);
 
+static MYSQL_SYSVAR_UINT(read_ahead_scan_pages, srv_read_ahead_scan_pages,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of leaf pages to read ahead of an ascending, descending or"
+  " strided index scan. 0 (default) uses innodb_read_ahead_threshold",
+  NULL, NULL, 0, 0, 256, 0);
+
 static MYSQL_SYSVAR_STR(monitor_enable, innobase_enable_monitor_counter,
   PLUGIN_VAR_RQCMDARG,
   "Turn on a monitor counter",
@@ -19979,12 +20438,14 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_chunk_size),
   MYSQL_SYSVAR(buffer_pool_filename),
   MYSQL_SYSVAR(buffer_pool_dump_now),
+  MYSQL_SYSVAR(buffer_pool_dump_interval),
   MYSQL_SYSVAR(buffer_pool_dump_at_shutdown),
   MYSQL_SYSVAR(buffer_pool_dump_pct),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buffer_pool_evict),
 #endif /* UNIV_DEBUG */
   MYSQL_SYSVAR(buffer_pool_load_now),
+  MYSQL_SYSVAR(buffer_pool_index_stats),
   MYSQL_SYSVAR(buffer_pool_load_abort),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buffer_pool_load_pages_abort),
@@ -19992,7 +20453,10 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_load_at_startup),
   MYSQL_SYSVAR(lru_scan_depth),
   MYSQL_SYSVAR(lru_flush_size),
+  MYSQL_SYSVAR(lru_policy),
   MYSQL_SYSVAR(flush_neighbors),
+  MYSQL_SYSVAR(flush_workers),
+  MYSQL_SYSVAR(flush_workers_partition),
   MYSQL_SYSVAR(checksum_algorithm),
   MYSQL_SYSVAR(compression_level),
   MYSQL_SYSVAR(data_file_path),
@@ -20003,12 +20467,14 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(use_atomic_writes),
   MYSQL_SYSVAR(fast_shutdown),
   MYSQL_SYSVAR(read_io_threads),
+  MYSQL_SYSVAR(recovery_threads),
   MYSQL_SYSVAR(write_io_threads),
   MYSQL_SYSVAR(file_per_table),
   MYSQL_SYSVAR(flush_log_at_timeout),
   MYSQL_SYSVAR(flush_log_at_trx_commit),
   MYSQL_SYSVAR(flush_method),
   MYSQL_SYSVAR(force_recovery),
+  MYSQL_SYSVAR(fetch_cache_rows),
   MYSQL_SYSVAR(fill_factor),
   MYSQL_SYSVAR(ft_cache_size),
   MYSQL_SYSVAR(ft_total_cache_size),
@@ -20019,8 +20485,10 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(ft_num_word_optimize),
   MYSQL_SYSVAR(ft_sort_pll_degree),
   MYSQL_SYSVAR(lock_wait_timeout),
+  MYSQL_SYSVAR(parallel_read_threads),
   MYSQL_SYSVAR(deadlock_detect),
   MYSQL_SYSVAR(deadlock_report),
+  MYSQL_SYSVAR(deadlock_check_depth),
   MYSQL_SYSVAR(page_size),
   MYSQL_SYSVAR(log_buffer_size),
   MYSQL_SYSVAR(log_file_mmap),
@@ -20032,8 +20500,12 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(data_file_write_through),
   MYSQL_SYSVAR(log_file_size),
   MYSQL_SYSVAR(log_write_ahead_size),
+  MYSQL_SYSVAR(log_compress),
+  MYSQL_SYSVAR(log_checkpoint_dirty_pages),
   MYSQL_SYSVAR(log_spin_wait_delay),
   MYSQL_SYSVAR(log_group_home_dir),
+  MYSQL_SYSVAR(log_archive_dir),
+  MYSQL_SYSVAR(log_archive_files),
   MYSQL_SYSVAR(max_dirty_pages_pct),
   MYSQL_SYSVAR(max_dirty_pages_pct_lwm),
   MYSQL_SYSVAR(adaptive_flushing_lwm),
@@ -20042,6 +20514,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(flushing_avg_loops),
   MYSQL_SYSVAR(max_purge_lag),
   MYSQL_SYSVAR(max_purge_lag_delay),
+  MYSQL_SYSVAR(max_purge_lag_per_table),
   MYSQL_SYSVAR(max_purge_lag_wait),
   MYSQL_SYSVAR(old_blocks_pct),
   MYSQL_SYSVAR(old_blocks_time),
@@ -20070,6 +20543,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(merge_sort_threads),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -20080,12 +20554,16 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(use_native_aio),
 #ifdef __linux__
   MYSQL_SYSVAR(linux_aio),
+  MYSQL_SYSVAR(io_uring_sqpoll),
+  MYSQL_SYSVAR(io_uring_fixed),
 #endif
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
+  MYSQL_SYSVAR(numa_partition),
 #endif /* HAVE_LIBNUMA */
   MYSQL_SYSVAR(random_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
+  MYSQL_SYSVAR(read_ahead_scan_pages),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
   MYSQL_SYSVAR(instant_alter_column_allowed),
@@ -20097,6 +20575,8 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(monitor_reset_all),
   MYSQL_SYSVAR(purge_threads),
   MYSQL_SYSVAR(purge_batch_size),
+  MYSQL_SYSVAR(purge_read_ahead),
+  MYSQL_SYSVAR(undo_version_cache_size),
   MYSQL_SYSVAR(log_checkpoint_now),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buf_flush_list_now),
@@ -20176,6 +20656,7 @@ i_s_innodb_cmp_per_index,
 i_s_innodb_cmp_per_index_reset,
 i_s_innodb_buffer_page,
 i_s_innodb_buffer_page_lru,
+i_s_innodb_buffer_pool_index_stats,
 i_s_innodb_buffer_stats,
 i_s_innodb_metrics,
 i_s_innodb_ft_default_stopword,
@@ -23,6 +23,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "table.h"
 
+#include <unordered_set>
+
 /* The InnoDB handler: the interface between MySQL and InnoDB. */
 
 /** Prebuilt structures in an InnoDB table handle used within MySQL */
@@ -152,6 +154,8 @@ class ha_innobase final : public handler
 
 	int rnd_next(uchar *buf) override;
 
+	int sample_next(uchar *buf, double fraction) override;
+
 	int rnd_pos(uchar * buf, uchar *pos) override;
 
 	int ft_init() override;
@@ -185,6 +189,8 @@ class ha_innobase final : public handler
 
 	ha_rows estimate_rows_upper_bound() override;
 
+	ha_rows records() override;
+
 	void update_create_info(HA_CREATE_INFO* create_info) override;
 
 	int create(
@@ -474,6 +480,7 @@ class ha_innobase final : public handler
 	void update_thd();
 
 	int general_fetch(uchar* buf, uint direction, uint match_mode);
+	int sample_block(uchar *buf);
 	int change_active_index(uint keynr);
 	/* @return true if it's necessary to switch current statement log
 	format from STATEMENT to ROW if binary log format is MIXED and
@@ -524,6 +531,25 @@ class ha_innobase final : public handler
 	not yet fetched any row, else false */
 	bool			m_start_of_scan;
 
+	/** number of rows that sample_next() still has to return
+	from random leaf pages, or HA_POS_ERROR if it samples rows
+	of a full table scan */
+	ha_rows			m_sample_left;
+
+	/** number of rows that remain to be read from the current
+	leaf page of sample_next() */
+	ulint			m_sample_block;
+
+	/** the primary key of the first record of the latest leaf page
+	of sample_next(), allocated from m_prebuilt->heap */
+	byte*			m_sample_key;
+
+	/** the size of m_sample_key in bytes */
+	ulint			m_sample_key_size;
+
+	/** the leaf pages that sample_next() has already chosen */
+	std::unordered_set<uint32_t> m_sample_pages;
+
 	/*!< match mode of the latest search: ROW_SEL_EXACT,
 	ROW_SEL_EXACT_PREFIX, or undefined */
 	uint			m_last_match_mode;
@@ -4362,6 +4362,164 @@ struct st_maria_plugin	i_s_innodb_buffer_page_lru =
 	MariaDB_PLUGIN_MATURITY_STABLE
 };
 
+namespace Show {
+/* Fields of the dynamic table
+INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS */
+static ST_FIELD_INFO i_s_innodb_buffer_pool_index_stats_fields_info[]=
+{
+#define IDX_BUF_INDEX_DATABASE_NAME	0
+  Column("DATABASE_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define IDX_BUF_INDEX_TABLE_NAME	1
+  Column("TABLE_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define IDX_BUF_INDEX_INDEX_NAME	2
+  Column("INDEX_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define IDX_BUF_INDEX_INDEX_ID		3
+  Column("INDEX_ID", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_PAGES		4
+  Column("PAGES", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_DIRTY_PAGES	5
+  Column("DIRTY_PAGES", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_HITS		6
+  Column("HITS", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_MISSES		7
+  Column("MISSES", ULonglong(), NOT_NULL),
+
+  CEnd()
+};
+} // namespace Show
+
+/** Fill INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS.
+The counters are read without any latch, so that this is cheap
+even on a large buffer pool; the names are resolved for the indexes
+that are present in the data dictionary cache.
+@return 0 on success, 1 on failure */
+static int i_s_innodb_buffer_pool_index_stats_fill(THD *thd,
+                                                   TABLE_LIST *tables, Item*)
+{
+  TABLE *table= tables->table;
+  Field **fields= table->field;
+  int status= 0;
+
+  DBUG_ENTER("i_s_innodb_buffer_pool_index_stats_fill");
+
+  /* deny access to users without PROCESS_ACL privilege */
+  if (check_global_access(thd, PROCESS_ACL))
+    DBUG_RETURN(0);
+
+  RETURN_IF_INNODB_NOT_STARTED(tables->schema_table_name.str);
+
+  dict_sys.freeze(SRW_LOCK_CALL);
+
+  for (size_t s= 1; s < buf_index_stats_t::N_SLOTS; s++)
+  {
+    const buf_index_stats_t::slot_t &slot= buf_index_stats.get(s);
+    const index_id_t id= slot.id.load(std::memory_order_relaxed);
+    if (!id || id == buf_index_stats_t::DROPPED)
+      continue;
+    /* The counters are updated without any synchronization.
+    Clamp any transiently negative values. */
+    const ssize_t pages= std::max(ssize_t(slot.pages), ssize_t{0});
+    const ssize_t dirty= std::min(std::max(ssize_t(slot.dirty), ssize_t{0}),
+                                  pages);
+    const ulonglong hits= buf_index_stats.hits(s),
+      misses= buf_index_stats.misses(s);
+    if (!pages && !hits && !misses)
+      continue;
+
+    if (const dict_index_t *index= dict_index_get_if_in_cache_low(id))
+    {
+      char db_utf8[MAX_DB_UTF8_LEN];
+      char table_utf8[MAX_TABLE_UTF8_LEN];
+
+      dict_fs2utf8(index->table->name.m_name,
+                   db_utf8, sizeof db_utf8, table_utf8, sizeof table_utf8);
+      status= field_store_string(fields[IDX_BUF_INDEX_DATABASE_NAME],
+                                 db_utf8) ||
+        field_store_string(fields[IDX_BUF_INDEX_TABLE_NAME], table_utf8) ||
+        field_store_string(fields[IDX_BUF_INDEX_INDEX_NAME], index->name);
+    }
+    else
+    {
+      fields[IDX_BUF_INDEX_DATABASE_NAME]->set_null();
+      fields[IDX_BUF_INDEX_TABLE_NAME]->set_null();
+      fields[IDX_BUF_INDEX_INDEX_NAME]->set_null();
+    }
+
+    if (status ||
+        fields[IDX_BUF_INDEX_INDEX_ID]->store(id, true) ||
+        fields[IDX_BUF_INDEX_PAGES]->store(pages, true) ||
+        fields[IDX_BUF_INDEX_DIRTY_PAGES]->store(dirty, true) ||
+        fields[IDX_BUF_INDEX_HITS]->store(hits, true) ||
+        fields[IDX_BUF_INDEX_MISSES]->store(misses, true) ||
+        schema_table_store_record(thd, table))
+    {
+      status= 1;
+      break;
+    }
+  }
+
+  dict_sys.unfreeze();
+  DBUG_RETURN(status);
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS.
+@return 0 on success */
+static int i_s_innodb_buffer_pool_index_stats_init(void *p)
+{
+  DBUG_ENTER("i_s_innodb_buffer_pool_index_stats_init");
+  ST_SCHEMA_TABLE *schema= static_cast<ST_SCHEMA_TABLE*>(p);
+
+  schema->fields_info= Show::i_s_innodb_buffer_pool_index_stats_fields_info;
+  schema->fill_table= i_s_innodb_buffer_pool_index_stats_fill;
+
+  DBUG_RETURN(0);
+}
+
+struct st_maria_plugin	i_s_innodb_buffer_pool_index_stats =
+{
+	/* the plugin type (a MYSQL_XXX_PLUGIN value) */
+	/* int */
+	MYSQL_INFORMATION_SCHEMA_PLUGIN,
+
+	/* pointer to type-specific plugin descriptor */
+	/* void* */
+	&i_s_info,
+
+	/* plugin name */
+	/* const char* */
+	"INNODB_BUFFER_POOL_INDEX_STATS",
+
+	/* plugin author (for SHOW PLUGINS) */
+	/* const char* */
+	plugin_author,
+
+	/* general descriptive text (for SHOW PLUGINS) */
+	/* const char* */
+	"InnoDB Buffer Pool Statistics per Index",
+
+	/* the plugin license (PLUGIN_LICENSE_XXX) */
+	/* int */
+	PLUGIN_LICENSE_GPL,
+
+	/* the function to invoke when plugin is loaded */
+	/* int (*)(void*); */
+	i_s_innodb_buffer_pool_index_stats_init,
+
+	/* the function to invoke when plugin is unloaded */
+	/* int (*)(void*); */
+	i_s_common_deinit,
+
+	i_s_version, nullptr, nullptr, PACKAGE_VERSION,
+	MariaDB_PLUGIN_MATURITY_STABLE
+};
+
 /*******************************************************************//**
 Unbind a dynamic INFORMATION_SCHEMA table.
 @return 0 */
@@ -30,6 +30,7 @@ Created 2/23/1996 Heikki Tuuri
 #include "btr0cur.h"
 #include "btr0btr.h"
 #include "gis0rtree.h"
+#include "buf0rea.h"
 
 /* Relative positions for a stored cursor position */
 enum btr_pcur_pos_t {
@@ -346,6 +347,9 @@ struct btr_pcur_t
   byte *old_rec_buf= nullptr;
   /** old_rec_buf size if old_rec_buf is not NULL */
   ulint buf_size= 0;
+  /** access pattern of btr_pcur_move_to_next_page() and
+  btr_pcur_move_backward_from_page() for buf_read_ahead_scan() */
+  buf_read_ahead_scan_t read_ahead;
 
   /** Return the index of this persistent cursor */
   dict_index_t *index() const { return(btr_cur.index()); }
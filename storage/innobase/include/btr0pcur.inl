@@ -297,6 +297,7 @@ btr_pcur_init(
 	pcur->old_rec = NULL;
 
 	pcur->btr_cur.rtr_info = NULL;
+	pcur->read_ahead = buf_read_ahead_scan_t();
 }
 
 /** Opens an persistent cursor to an index tree without initializing the
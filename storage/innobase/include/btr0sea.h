@@ -118,6 +118,9 @@ struct btr_sea
 
   /** Unlock the adaptive hash search system. */
   ATTRIBUTE_COLD void unlock() noexcept;
+
+  /** Wait for all optimistic lookups to finish after enabled=false */
+  ATTRIBUTE_COLD void wait_for_lookups() noexcept;
 public:
   /** Disable the adaptive hash search system and empty the index.
   @return whether the adaptive hash index was enabled */
@@ -227,6 +230,12 @@ struct btr_sea
     IF_DBUG(srw_lock_debug,srw_spin_lock) latch;
     /** map of CRC-32C of rec prefix to rec_t* in buf_page_t::frame */
     hash_table table;
+    /** number of started modifications of table or its elements;
+    an optimistic lookup is invalid if this changes or if this differs
+    from n_modify_end */
+    alignas(CPU_LEVEL1_DCACHE_LINESIZE) std::atomic<uint32_t> n_modify_start;
+    /** number of completed modifications of table or its elements */
+    std::atomic<uint32_t> n_modify_end;
     /** protects blocks; acquired while holding latch
     and possibly table.lock_get() */
     srw_mutex blocks_mutex;
@@ -237,6 +246,17 @@ struct btr_sea
 
     inline void init() noexcept;
 
+    /** Start modifying table or its elements while holding latch */
+    void modify_start() noexcept
+    {
+      n_modify_start.fetch_add(1, std::memory_order_relaxed);
+      /* This pairs with the acquire loads in btr_search_guess_on_hash() */
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    /** Finish modifying table or its elements */
+    void modify_end() noexcept
+    { n_modify_end.fetch_add(1, std::memory_order_release); }
+
     /** @return whether the allocation succeeded */
     inline bool alloc(size_t hash_size) noexcept;
 
@@ -328,6 +348,32 @@ struct btr_sea
   /** Partitions of the adaptive hash index */
   partition parts[512];
 
+  /** A stripe of optimistic lookups in btr_search_guess_on_hash() */
+  struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) lookup_stripe
+  {
+    /** number of ongoing lookups that were registered via this stripe */
+    std::atomic<uint32_t> n;
+  };
+  /** number of lookup stripes */
+  static constexpr unsigned N_LOOKUP_STRIPES= 64;
+  /** the lookup stripes; disable_and_lock() will wait for them to drain
+  before freeing any memory that an optimistic lookup may access */
+  lookup_stripe lookups[N_LOOKUP_STRIPES];
+  /** round-robin counter for assigning tls_lookup_stripe */
+  std::atomic<unsigned> next_lookup_stripe;
+  /** 1+index of the lookup stripe of the current thread, or 0 */
+  static thread_local unsigned tls_lookup_stripe;
+
+  /** @return the lookup stripe of the current thread */
+  lookup_stripe &get_lookup_stripe() noexcept
+  {
+    unsigned s= tls_lookup_stripe;
+    if (UNIV_UNLIKELY(!s))
+      tls_lookup_stripe= s= next_lookup_stripe.fetch_add
+        (1, std::memory_order_relaxed) % N_LOOKUP_STRIPES + 1;
+    return lookups[s - 1];
+  }
+
   /** Get an adaptive hash index partition */
   partition &get_part(index_id_t id) noexcept { return parts[id % n_parts]; }
 
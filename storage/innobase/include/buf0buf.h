@@ -452,6 +452,144 @@ class buf_tmp_buffer_t
   }
 };
 
+/** innodb_buffer_pool_index_stats: whether buf_index_stats is updated */
+extern my_bool innodb_buffer_pool_index_stats;
+
+/** Buffer pool occupancy and access statistics per index, for
+INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS. The counters are
+updated without holding any mutex. Slot 0 is assigned to the pages
+that do not belong to any tracked index; its counters are not updated.
+Pages are only assigned to slots while innodb_buffer_pool_index_stats=ON.
+The slot of an index is released by release() when the index is dropped,
+and reused for another index once its last page has left the buffer pool. */
+class buf_index_stats_t
+{
+public:
+  /** number of slots */
+  static constexpr size_t N_SLOTS= 4096;
+  /** number of copies of the access counters, to avoid contention */
+  static constexpr size_t N_SHARDS= 16;
+  /** slot_t::id of a slot whose index has been dropped */
+  static constexpr index_id_t DROPPED= ~index_id_t{0};
+
+  /** statistics of an index */
+  struct slot_t
+  {
+    /** PAGE_INDEX_ID, DROPPED, or 0 if the slot is unused */
+    std::atomic<index_id_t> id;
+    /** number of pages in the buffer pool */
+    Atomic_counter<size_t> pages;
+    /** number of pages that are waiting to be written back */
+    Atomic_counter<size_t> dirty;
+  };
+
+  /** Look up or allocate a slot for an index.
+  @param id   PAGE_INDEX_ID
+  @return slot number
+  @retval 0 if no slot is available or innodb_buffer_pool_index_stats=OFF */
+  uint16_t find(index_id_t id) noexcept;
+
+  /** Release the slot of a dropped index.
+  @param id   PAGE_INDEX_ID */
+  void release(index_id_t id) noexcept;
+
+  /** Move a page between slots.
+  @param from   previous slot
+  @param to     new slot
+  @param dirty  whether the page is in buf_pool.flush_list */
+  void move(uint16_t from, uint16_t to, bool dirty) noexcept
+  {
+    if (from)
+    {
+      slots[from].pages--;
+      if (dirty)
+        slots[from].dirty--;
+    }
+    if (to)
+    {
+      slots[to].pages++;
+      if (dirty)
+        slots[to].dirty++;
+    }
+  }
+
+  void evict(uint16_t s) noexcept { if (s) slots[s].pages--; }
+  void dirty_inc(uint16_t s) noexcept { if (s) slots[s].dirty++; }
+  void dirty_dec(uint16_t s) noexcept { if (s) slots[s].dirty--; }
+  void hit(uint16_t s) noexcept
+  {
+    if (s && innodb_buffer_pool_index_stats)
+      shards[shard()][s].hits.fetch_add(1);
+  }
+  void miss(uint16_t s) noexcept
+  {
+    if (s && innodb_buffer_pool_index_stats)
+      shards[shard()][s].misses.fetch_add(1);
+  }
+
+  /** @return a slot */
+  const slot_t &get(size_t s) const noexcept { return slots[s]; }
+  /** @return the number of page requests that found the page in
+  the buffer pool */
+  ulonglong hits(size_t s) const noexcept
+  {
+    ulonglong n= 0;
+    for (const auto &shard : shards)
+      n+= shard[s].hits;
+    return n;
+  }
+  /** @return the number of page requests that had to read the page */
+  ulonglong misses(size_t s) const noexcept
+  {
+    ulonglong n= 0;
+    for (const auto &shard : shards)
+      n+= shard[s].misses;
+    return n;
+  }
+
+private:
+  /** @return the access counter shard of the current thread */
+  static size_t shard() noexcept
+  {
+#ifdef HAVE_SCHED_GETCPU
+    int cpu= sched_getcpu();
+    if (cpu >= 0)
+      return size_t(cpu) % N_SHARDS;
+#endif
+    return size_t(my_pseudo_random()) % N_SHARDS;
+  }
+
+  /** Reset the access counters of a slot.
+  @param s   slot number */
+  void reset(size_t s) noexcept
+  {
+    for (auto &shard : shards)
+    {
+      shard[s].hits= 0;
+      shard[s].misses= 0;
+    }
+  }
+
+  /** access counters of an index */
+  struct counters_t
+  {
+    /** number of page requests that found the page in the buffer pool */
+    Atomic_relaxed<ulonglong> hits;
+    /** number of page requests that had to read the page */
+    Atomic_relaxed<ulonglong> misses;
+  };
+
+  /** maximum number of slots that find() will probe */
+  static constexpr size_t N_PROBES= 32;
+  /** the slots */
+  slot_t slots[N_SLOTS];
+  /** the access counters; each shard occupies separate cache lines */
+  alignas(CPU_LEVEL1_DCACHE_LINESIZE) counters_t shards[N_SHARDS][N_SLOTS];
+};
+
+/** Buffer pool statistics per index */
+extern buf_index_stats_t buf_index_stats;
+
 /** The common buffer control block structure
 for compressed and uncompressed frames */
 
@@ -569,6 +707,13 @@ class buf_page_t
 	Atomic_counter<unsigned> access_time;	/*!< time of first access, or
 					0 if the block was never accessed
 					in the buffer pool. */
+  /** whether buf_page_make_young() was requested with
+  innodb_lru_policy=clock since the block was last moved to the start
+  of buf_pool.LRU; not protected by any mutex or latch */
+  Atomic_relaxed<bool> referenced;
+  /** slot in buf_index_stats; protected by lock or a read-fix,
+  or by buf_pool.mutex when the page is being evicted */
+  uint16_t index_stats;
   buf_page_t() : id_{0}
   {
     static_assert(NOT_USED == 0, "compatibility");
@@ -585,7 +730,8 @@ class buf_page_t
     in_page_hash(b.in_page_hash), in_free_list(b.in_free_list),
 #endif /* UNIV_DEBUG */
     list(b.list), LRU(b.LRU), old(b.old), freed_page_clock(b.freed_page_clock),
-    access_time(b.access_time)
+    access_time(b.access_time), referenced(b.referenced),
+    index_stats(b.index_stats)
   {
     lock.init();
   }
@@ -604,6 +750,8 @@ class buf_page_t
     old= 0;
     freed_page_clock= 0;
     access_time= 0;
+    referenced= false;
+    index_stats= 0;
   }
 
   void set_os_unused() const
@@ -709,8 +857,23 @@ class buf_page_t
   {
     ut_ad(oldest_modification() > 2);
     oldest_modification_.store(1, std::memory_order_release);
+    buf_index_stats.dirty_dec(index_stats);
   }
 
+  /** Assign the page to buf_index_stats.
+  @param s   slot number */
+  void set_index_stats(uint16_t s) noexcept
+  {
+    if (s != index_stats)
+    {
+      buf_index_stats.move(index_stats, s, oldest_modification() > 2);
+      index_stats= s;
+    }
+  }
+  /** Assign the page to buf_index_stats based on its contents.
+  @param page   page frame */
+  void set_index_stats(const byte *page) noexcept;
+
   /** Complete a read of a page.
   @param node     data file
   @param recovery recv_recovery_is_on()
@@ -732,8 +895,45 @@ class buf_page_t
 
   /** Write a flushable page to a file or free a freeable block.
   @param space       tablespace
+  @param n_workers   number of flush workers that the write may be handed
+  to (innodb_flush_workers at the start of the batch), or 0; if nonzero,
+  the caller must invoke buf_flush_workers_wait() before
+  buf_dblwr.flush_buffered_writes()
   @return whether a page write was initiated and buf_pool.mutex released */
-  bool flush(fil_space_t *space) noexcept;
+  bool flush(fil_space_t *space, uint n_workers= 0) noexcept;
+
+  /** Apply the checksum, encryption and compression to a write-fixed
+  page, and submit the write.
+  @param space       tablespace, with a reference held for the write
+  @param s           state() before the page was write-fixed
+  @param lsn         FIL_PAGE_LSN of the page */
+  void write_out(fil_space_t *space, uint32_t s, lsn_t lsn) noexcept;
+
+  /** A page write that has been prepared by write_prepare() */
+  struct prepared_write
+  {
+    /** the page frame to be written */
+    byte *frame;
+    /** buffer reserved for encryption or compression, or nullptr */
+    buf_tmp_buffer_t *slot;
+    /** number of bytes to write */
+    size_t size;
+    /** type of the write request */
+    IORequest::Type type;
+  };
+
+  /** Apply the checksum, encryption and compression to a write-fixed page.
+  @param space       tablespace, with a reference held for the write
+  @param w           the prepared write */
+  void write_prepare(fil_space_t *space, prepared_write *w) noexcept;
+
+  /** Submit a write that was prepared by write_prepare().
+  @param space       tablespace, with a reference held for the write
+  @param s           state() before the page was write-fixed
+  @param lsn         FIL_PAGE_LSN of the page
+  @param w           the prepared write */
+  void write_submit(fil_space_t *space, uint32_t s, lsn_t lsn,
+                    const prepared_write &w) noexcept;
 
   /** Notify that a page in a temporary tablespace has been modified. */
   void set_temp_modified() noexcept
@@ -1093,6 +1293,21 @@ class buf_pool_t
   char *memory_unaligned;
   /** the virtual address range size of memory_unaligned */
   size_t size_unaligned;
+#ifndef _WIN32
+  /** the size of the large pages whose commitment follows the
+  innodb_buffer_pool_size, or 0 if large pages are not being used or
+  the whole memory_unaligned was populated by my_large_virtual_alloc() */
+  size_t large_page_size;
+
+  /** @return the end of the committed memory for a buffer pool size */
+  char *committed_end(size_t size) const noexcept
+  {
+    return large_page_size
+      ? reinterpret_cast<char*>(ut_calc_align(size_t(memory + size),
+                                              large_page_size))
+      : memory + size;
+  }
+#endif
 #ifdef UNIV_PFS_MEMORY
   /** the "owner thread" of the buffer pool allocation */
   PSI_thread *owner;
@@ -1184,6 +1399,11 @@ class buf_pool_t
   @param trx    current connnection */
   ATTRIBUTE_COLD void resize(size_t size, THD *thd) noexcept;
 
+  /** Register the committed buffer pool memory with os_aio_register_buffers(),
+  or unregister it before the memory is decommitted.
+  @param reg   whether to register the memory */
+  void register_buffers(bool reg) const noexcept;
+
   /** Collect garbage (release pages from the LRU list) */
   inline void garbage_collect() noexcept;
 
@@ -1260,7 +1480,6 @@ class buf_pool_t
   @return the block descriptor */
   buf_block_t *get_nth_page(size_t pos) const noexcept;
 
-#ifdef UNIV_DEBUG
   /** Determine if an object is within the curr_pool_size()
   and associated with an uncompressed page.
   @param ptr   memory object (not dereferenced)
@@ -1270,7 +1489,6 @@ class buf_pool_t
     const ptrdiff_t d= static_cast<const char*>(ptr) - memory;
     return d >= 0 && size_t(d) < curr_pool_size();
   }
-#endif
 
 public:
   /** page_fix() mode of operation */
@@ -1621,6 +1839,41 @@ class buf_pool_t
   /** withdrawn blocks during resize() */
   UT_LIST_BASE_NODE_T(buf_page_t) withdrawn;
 
+#ifdef HAVE_LIBNUMA
+  /** innodb_numa_partition: the extents of the buffer pool are divided
+  into n_slices contiguous slices, each bound to one NUMA node */
+  struct numa_partition_t
+  {
+    /** number of slices; 0 if the buffer pool is not partitioned */
+    unsigned n_slices;
+    /** number of extents in each slice (except possibly the last one) */
+    size_t extents_per_slice;
+    /** the number of elements in cpu_slice[] */
+    unsigned n_cpus;
+    /** mapping from sched_getcpu() to the slice of its NUMA node */
+    byte *cpu_slice;
+  } numa;
+
+  /** Initialize numa and bind each slice to its NUMA node. */
+  ATTRIBUTE_COLD void numa_partition_init() noexcept;
+
+  /** @return the slice that a buffer pool block resides in */
+  unsigned numa_slice(const buf_page_t *bpage) const noexcept
+  {
+    ut_ad(numa.n_slices);
+    const size_t extent= (reinterpret_cast<const char*>(bpage) - memory) /
+      innodb_buffer_pool_extent_size;
+    return unsigned(std::min<size_t>(extent / numa.extents_per_slice,
+                                     numa.n_slices - 1));
+  }
+
+  /** @return the slice of the NUMA node that the current thread runs on */
+  unsigned numa_local_slice() const noexcept;
+#endif /* HAVE_LIBNUMA */
+
+  /** @return the block from free that allocate() should return next */
+  inline buf_page_t *free_first() const noexcept;
+
 public:
   /** list of blocks available for allocate() */
   UT_LIST_BASE_NODE_T(buf_page_t) free;
@@ -1805,6 +2058,7 @@ inline void buf_page_t::set_oldest_modification(lsn_t lsn) noexcept
   ut_ad(oldest_modification() <= 1);
   ut_ad(lsn > 2);
   oldest_modification_= lsn;
+  buf_index_stats.dirty_inc(index_stats);
 }
 
 /** Clear oldest_modification after removing from buf_pool.flush_list */
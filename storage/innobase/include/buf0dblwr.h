@@ -85,7 +85,11 @@ class buf_dblwr_t
     /** Use the doublewrite buffer with full durability */
     USE_YES,
     /** Durable writes to the doublewrite buffer, not to data files */
-    USE_FAST
+    USE_FAST,
+    /** Like USE_YES, but write a page image to the redo log when a
+    page is first modified after it was written, so that the
+    doublewrite buffer is only needed for the remaining pages */
+    USE_LOG
   };
   /** The value of innodb_doublewrite */
   ulong use;
@@ -155,11 +159,13 @@ class buf_dblwr_t
   /** @return whether the doublewrite buffer is in use */
   bool in_use() const { return is_created() && use; }
   /** @return whether fsync() is needed on non-doublewrite pages */
-  bool need_fsync() const { return use < USE_FAST; }
+  bool need_fsync() const { return use != USE_FAST; }
+  /** @return whether page images are to be written to the redo log */
+  bool log_page_images() const { return use == USE_LOG; }
 
   void set_use(ulong use)
   {
-    ut_ad(use <= USE_FAST);
+    ut_ad(use <= USE_LOG);
     mysql_mutex_lock(&mutex);
     this->use= use;
     mysql_mutex_unlock(&mutex);
@@ -38,6 +38,13 @@ void buf_load_abort();
 /** Start async buffer pool load, if srv_buffer_pool_load_at_startup was set.*/
 void buf_load_at_startup();
 
+/** innodb_buffer_pool_dump_interval: seconds between periodic dumps,
+or 0 to dump only at shutdown and on request */
+extern uint srv_buf_pool_dump_interval;
+
+/** Apply a change of innodb_buffer_pool_dump_interval. */
+void buf_dump_interval_update();
+
 /** Wait for currently running load/dumps to finish*/
 void buf_load_dump_end();
 
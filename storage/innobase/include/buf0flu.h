@@ -39,6 +39,23 @@ extern ulint buf_lru_freed_page_count;
 /** Flag indicating if the page_cleaner is in active state. */
 extern Atomic_relaxed<bool> buf_page_cleaner_is_active;
 
+/** innodb_flush_workers: number of tasks that page cleaner batches
+hand the page writes to; 0 if the batch submits the writes itself */
+extern uint innodb_flush_workers;
+
+/** How innodb_flush_workers are assigned the pages to write */
+enum flush_workers_partition_t
+{
+  /** by tablespace id, so that a worker keeps writing the same files */
+  FLUSH_WORKERS_PARTITION_TABLESPACE,
+  /** by page number, so that pages of a single tablespace are
+  checksummed and encrypted by all workers in parallel */
+  FLUSH_WORKERS_PARTITION_PAGE
+};
+
+/** innodb_flush_workers_partition */
+extern ulong innodb_flush_workers_partition;
+
 /** Remove all dirty pages belonging to a given tablespace when we are
 deleting the data file of that tablespace.
 The pages still remain a part of LRU and are evicted from
@@ -113,9 +113,16 @@ buf_LRU_add_block(
 				start; if the LRU list is very short, added to
 				the start regardless of this parameter */
 
-/** Move a block to the start of the buf_pool.LRU list.
+/** Move a block to the start of the buf_pool.LRU list, or with
+innodb_lru_policy=clock, only flag it for buf_LRU_second_chance().
 @param bpage  buffer pool page */
 void buf_page_make_young(buf_page_t *bpage);
+/** Move a block that buf_page_make_young() flagged with
+innodb_lru_policy=clock to the start of buf_pool.LRU,
+instead of evicting or flushing it.
+@param bpage  block near the end of buf_pool.LRU
+@return whether the block was moved */
+bool buf_LRU_second_chance(buf_page_t *bpage) noexcept;
 /** Flag a page accessed in buf_pool and move it to the start of buf_pool.LRU
 if it is too old.
 @param bpage  buffer pool page
@@ -182,6 +189,19 @@ The minimum must exceed
 /** Move blocks to "new" LRU list only if the first access was at
 least this many milliseconds ago.  Not protected by any mutex or latch. */
 extern uint	buf_LRU_old_threshold_ms;
+
+/** innodb_lru_policy */
+enum buf_LRU_policy_t
+{
+  /** move blocks to the start of buf_pool.LRU on access */
+  BUF_LRU_MIDPOINT,
+  /** set buf_page_t::referenced on access, and move blocks to the
+  start of buf_pool.LRU when they would be evicted */
+  BUF_LRU_CLOCK
+};
+
+/** innodb_lru_policy; not protected by any mutex or latch */
+extern ulong	buf_LRU_policy;
 /* @} */
 
 /** @brief Statistics for selecting the LRU list for eviction.
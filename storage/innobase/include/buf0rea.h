@@ -87,6 +87,38 @@ latches!
 @return number of page read requests issued */
 ulint buf_read_ahead_linear(const page_id_t page_id) noexcept;
 
+/** State of buf_read_ahead_scan() for a persistent cursor */
+struct buf_read_ahead_scan_t
+{
+  /** the page number of the previously visited leaf page, or FIL_NULL */
+  uint32_t last_page= FIL_NULL;
+  /** the difference of the page numbers of the last two visited pages */
+  int32_t stride= 0;
+  /** number of consecutive moves by the same stride */
+  uint32_t run= 0;
+  /** number of consecutive moves to a sibling page */
+  uint32_t moves= 0;
+  /** the last page number that was submitted for reading, or FIL_NULL */
+  uint32_t requested= FIL_NULL;
+};
+
+/** Read ahead leaf pages for a persistent cursor that moved to a sibling
+page. If the cursor has been moving by a constant difference of page
+numbers (such as +1 for an ascending and -1 for a descending scan of
+an unfragmented index), submit asynchronous reads of the following
+innodb_read_ahead_scan_pages pages by that stride. Otherwise, if the
+cursor has been moving to siblings, read the next sibling.
+NOTE: the calling thread may own latches on pages: to avoid deadlocks this
+function must be written such that it cannot end up waiting for these
+latches!
+@param state    read-ahead state of the cursor
+@param page_id  the page that the cursor moved to
+@param sibling  FIL_PAGE_NEXT or FIL_PAGE_PREV of the page, in the
+                direction of the scan
+@return number of page read requests issued */
+ulint buf_read_ahead_scan(buf_read_ahead_scan_t &state, const page_id_t page_id,
+                          uint32_t sibling) noexcept;
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
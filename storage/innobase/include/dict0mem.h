@@ -2478,6 +2478,11 @@ struct dict_table_t {
   lock_sys.assert_locked(page_id) and trx->mutex_is_owner() hold.
   @see trx_lock_t::trx_locks */
   Atomic_counter<uint32_t> n_rec_locks;
+  /** Number of active (or XA PREPARE) transactions that may hold implicit
+  locks on records of this table.
+  @see trx_mod_table_time_t::start_modifying()
+  @see lock_sec_rec_some_has_impl() */
+  Atomic_counter<uint32_t> n_active_modifiers;
 private:
   /** Count of how many handles are opened to this table. Dropping of the
   table is NOT allowed until this count gets to zero. MySQL does NOT
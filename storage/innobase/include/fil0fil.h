@@ -1069,6 +1069,9 @@ struct fil_node_t final
   unsigned punch_hole:2;
   /** whether this file could use atomic write */
   unsigned atomic_write:1;
+  /** whether atomic_write requires page writes to be submitted
+  with RWF_ATOMIC */
+  unsigned rwf_atomic:1;
   /** whether the file actually is a raw device or disk partition */
   unsigned is_raw_disk:1;
   /** whether the tablespace discovery is being deferred during crash
@@ -45,6 +45,8 @@ class ReadView;
 extern my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 extern ulong innodb_deadlock_report;
+/** The value of innodb_deadlock_check_depth */
+extern uint innodb_deadlock_check_depth;
 
 namespace Deadlock
 {
@@ -1158,7 +1160,8 @@ struct TMTrxGuard
 #endif
 };
 
-/** Remove a record lock request, waiting or granted, on a discarded page
+/** Remove a record lock request, waiting or granted, on a discarded page.
+A granted record lock will be added to trx->lock.free_rec_locks for reuse.
 @param in_lock  lock object
 @param cell     hash table cell containing in_lock */
 void lock_rec_discard(lock_t *in_lock, hash_cell_t &cell) noexcept;
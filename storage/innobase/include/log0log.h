@@ -37,6 +37,8 @@ using st_::span;
 
 static const char LOG_FILE_NAME_PREFIX[] = "ib_logfile";
 static const char LOG_FILE_NAME[] = "ib_logfile0";
+/** The file for innodb_log_checkpoint_dirty_pages */
+static const char LOG_DIRTY_PAGES_FILE_NAME[] = "ib_dirty_pages";
 
 /** Composes full path for a redo log file
 @param[in]	filename	name of the redo log file
@@ -51,6 +53,16 @@ static inline void delete_log_file(const char* suffix)
   os_file_delete_if_exists_func(path.c_str(), nullptr);
 }
 
+/** Read redo log from innodb_log_archive_dir. Only complete blocks
+that were durably written to the archive will be read; the caller
+must read anything else from ib_logfile0.
+@param lsn   log sequence number, aligned to log_sys.write_size
+@param buf   output buffer
+@param size  size of buf, in bytes, aligned to log_sys.write_size
+@return number of bytes read
+@retval 0 if the log is not available in the archive */
+size_t log_archive_read(lsn_t lsn, byte *buf, size_t size) noexcept;
+
 struct completion_callback;
 
 /** Ensure that the log has been written to the log file up to a given
@@ -208,8 +220,111 @@ struct log_t
   bool latch_have_any() const { return latch.is_locked(); }
 # endif
 #endif
+
+  /** A read-write lock whose shared holders are counted in per-thread
+  stripes, so that concurrent mtr_t::commit() will not contend on
+  a single cache line. An exclusive holder will set a flag and wait
+  for all stripes to drain; while it is set, shared requests will
+  fall back to the underlying log_rwlock. */
+  class sharded_latch
+  {
+    /** number of reader stripes */
+    static constexpr unsigned N_STRIPES= 32;
+    /** a reader stripe */
+    struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) stripe
+    {
+      /** number of shared holders that acquired via this stripe */
+      std::atomic<uint32_t> readers;
+    };
+    /** the reader stripes */
+    stripe stripes[N_STRIPES];
+    /** whether an exclusive holder exists or is waiting for readers */
+    alignas(CPU_LEVEL1_DCACHE_LINESIZE) std::atomic<bool> writer;
+    /** round-robin counter for assigning tls_stripe */
+    std::atomic<unsigned> next_stripe;
+    /** the underlying lock, for exclusive and fallback shared holders */
+    log_rwlock latch;
+
+    /** 1+index of the stripe of the current thread, or 0 if unassigned */
+    static thread_local unsigned tls_stripe;
+    /** 0 if not holding a shared latch, 1 if holding via a stripe,
+    2 if holding latch.rd_lock() */
+    static thread_local unsigned char tls_state;
+
+    /** @return the stripe of the current thread */
+    stripe &get_stripe() noexcept
+    {
+      unsigned s= tls_stripe;
+      if (UNIV_UNLIKELY(!s))
+        tls_stripe= s= next_stripe.fetch_add(1, std::memory_order_relaxed) %
+          N_STRIPES + 1;
+      return stripes[s - 1];
+    }
+
+    /** Wait for all readers to leave the stripes */
+    ATTRIBUTE_NOINLINE void wait_for_readers() noexcept;
+  public:
+    void SRW_LOCK_INIT(mysql_pfs_key_t key) noexcept
+    {
+      for (stripe &s : stripes)
+        s.readers.store(0, std::memory_order_relaxed);
+      writer.store(false, std::memory_order_relaxed);
+      next_stripe.store(0, std::memory_order_relaxed);
+      latch.SRW_LOCK_INIT(key);
+    }
+    void destroy() noexcept { latch.destroy(); }
+
+    void rd_lock(SRW_LOCK_ARGS(const char *file, unsigned line)) noexcept
+    {
+      ut_ad(!tls_state);
+      stripe &s= get_stripe();
+      /* This pairs with the store and loads in wr_lock() */
+      s.readers.fetch_add(1);
+      if (UNIV_LIKELY(!writer.load()))
+      {
+        tls_state= 1;
+        return;
+      }
+      s.readers.fetch_sub(1, std::memory_order_release);
+      latch.rd_lock(SRW_LOCK_ARGS(file, line));
+      tls_state= 2;
+    }
+    void rd_unlock() noexcept
+    {
+      ut_ad(tls_state);
+      if (UNIV_LIKELY(tls_state == 1))
+        stripes[tls_stripe - 1].readers.fetch_sub(1,
+                                                  std::memory_order_release);
+      else
+        latch.rd_unlock();
+      tls_state= 0;
+    }
+    void wr_lock(SRW_LOCK_ARGS(const char *file, unsigned line)) noexcept
+    {
+      ut_ad(!tls_state);
+      latch.wr_lock(SRW_LOCK_ARGS(file, line));
+      writer.store(true);
+      wait_for_readers();
+    }
+    void wr_unlock() noexcept
+    {
+      writer.store(false, std::memory_order_release);
+      latch.wr_unlock();
+    }
+
+#ifdef LOG_LATCH_DEBUG
+    bool have_wr() const noexcept { return latch.have_wr(); }
+    bool have_rd() const noexcept { return tls_state != 0; }
+    bool have_any() const noexcept { return have_rd() || have_wr(); }
+#elif defined UNIV_DEBUG && !defined SUX_LOCK_GENERIC
+    bool is_write_locked() const noexcept { return latch.is_write_locked(); }
+    bool is_locked() const noexcept
+    { return tls_state != 0 || latch.is_locked(); }
+#endif
+  };
+
   /** latch_have_wr() for checkpoint, latch_have_any() for append_prepare() */
-  log_rwlock latch;
+  sharded_latch latch;
 
   /** log record buffer, written to by mtr_t::commit() */
   alignas(CPU_LEVEL1_DCACHE_LINESIZE) byte *buf;
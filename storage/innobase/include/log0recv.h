@@ -44,6 +44,15 @@ ATTRIBUTE_COLD MY_ATTRIBUTE((nonnull, warn_unused_result))
 @return whether the page was recovered correctly */
 bool recv_recover_page(fil_space_t* space, buf_page_t* bpage);
 
+/** Remove a page that innodb_log_checkpoint_dirty_pages made recovery read
+while the log was being parsed.
+@param space   tablespace
+@param id      page identifier
+@return a block that contains the page, but is not in buf_pool.page_hash
+@retval nullptr if the page was not read in advance */
+buf_block_t *recv_prefetched(const fil_space_t &space, const page_id_t id)
+  noexcept;
+
 /** Read the latest checkpoint information from log file
 and store it in log_sys.next_checkpoint and recv_sys.file_checkpoint
 @return error code or DB_SUCCESS */
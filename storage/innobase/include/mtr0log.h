@@ -245,6 +245,10 @@ inline void mtr_t::memcpy_low(const buf_block_t &block, uint16_t offset,
   set_modified(block);
   if (!is_logged())
     return;
+  if (len >= LOG_COMPRESS_MIN_LEN && srv_log_compress &&
+      offset >= 8 && block.page.id().page_no() >= 3 && !block.zip_size() &&
+      memcpy_compressed(block, offset, data, len))
+    return;
   if (len < mtr_buf_t::MAX_DATA_SIZE - (1 + 3 + 3 + 5 + 5))
   {
     byte *end= log_write<WRITE>(block.page.id(), &block.page, len, true,
@@ -660,6 +660,14 @@ struct mtr_t {
   @param len     length of the data, in bytes */
   inline void memcpy_low(const buf_block_t &block, uint16_t offset,
                          const void *data, size_t len);
+  /** Try to log a compressed write of a byte string to a page.
+  @param block   buffer page
+  @param offset  byte offset within page
+  @param data    data to be written
+  @param len     length of the data, in bytes
+  @return whether a WRITE_COMPRESSED record was written */
+  bool memcpy_compressed(const buf_block_t &block, uint16_t offset,
+                         const void *data, size_t len);
   /**
   Write a log record.
   @tparam type  redo log record type
@@ -682,6 +690,10 @@ struct mtr_t {
   tablespace was modified for the first time since fil_names_clear(). */
   ATTRIBUTE_NOINLINE ATTRIBUTE_COLD void name_write() noexcept;
 
+  /** Write INIT_PAGE and a full page image for each page that this
+  mini-transaction is making dirty, for innodb_doublewrite=log. */
+  ATTRIBUTE_NOINLINE void log_page_images() noexcept;
+
   /** Encrypt the log
   @return the total size in bytes, excluding the 8-byte nonce */
   ATTRIBUTE_NOINLINE size_t encrypt() noexcept;
@@ -281,7 +281,12 @@ enum mrec_ext_t
   This is similar to the old MLOG_COMP_REC_DELETE record. */
   DELETE_ROW_FORMAT_DYNAMIC= 9,
   /** Truncate a data file. */
-  TRIM_PAGES= 10
+  TRIM_PAGES= 10,
+  /** Write a string of bytes that was compressed with zlib.
+  Followed by the byte offset, the uncompressed length, and the
+  compressed data; written when innodb_log_compress=ON.
+  The current byte offset will be reset to FIL_PAGE_TYPE. */
+  WRITE_COMPRESSED= 11
 };
 
 
@@ -994,6 +994,16 @@ int os_aio_init() noexcept;
 Frees the asynchronous io system. */
 void os_aio_free() noexcept;
 
+/** Set the maximum number of concurrently executing read completion
+callbacks, which is normally innodb_read_io_threads.
+@param n  maximum number of callbacks */
+void os_aio_set_read_concurrency(uint n) noexcept;
+
+/** Register the buffer pool memory for asynchronous I/O.
+@param buf   start of the memory, or nullptr to unregister
+@param size  size of the memory, in bytes */
+void os_aio_register_buffers(void *buf, size_t size) noexcept;
+
 /** Submit a fake read request during crash recovery.
 @param type   fake read request
 @param offset additional context */
@@ -182,6 +182,12 @@ class ReadView: public ReadViewBase
   */
   trx_id_t m_creator_trx_id;
 
+  /**
+    trx_sys.get_rw_trx_hash_erases() before the snapshot was taken.
+    Used exclusively by the read view owner thread.
+  */
+  uint64_t m_rw_trx_hash_erases;
+
 public:
   ReadView()
   {
@@ -341,6 +341,7 @@ row_merge_file_create(
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL, stage->begin_phase_sort() will be called initially
 and then stage->inc() will be called for each record processed.
+@param[in]	n_threads	maximum number of threads for merging runs
 @return DB_SUCCESS or error code */
 dberr_t
 row_merge_sort(
@@ -355,7 +356,8 @@ row_merge_sort(
 	const double	pct_cost,
 	row_merge_block_t*	crypt_block,
 	ulint			space,
-	ut_stage_alter_t*	stage = NULL)
+	ut_stage_alter_t*	stage = NULL,
+	ulint			n_threads = 1)
 	MY_ATTRIBUTE((warn_unused_result));
 
 /*********************************************************************//**
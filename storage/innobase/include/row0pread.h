@@ -0,0 +1,63 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file include/row0pread.h
+Parallel consistent read of a clustered index
+*******************************************************/
+
+#pragma once
+
+#include "univ.i"
+#include "rem0types.h"
+#include "trx0types.h"
+#include "dict0types.h"
+
+/** Callback for each record that is visible in the read view.
+@param rec      the clustered index record, or its visible version
+@param offsets  rec_get_offsets(rec)
+@param worker   number of the worker, less than n_workers
+@param arg      the argument that was passed to row_parallel_scan()
+@return whether the scan should continue */
+typedef bool (*row_pread_callback_t)(const rec_t *rec, const rec_offs *offsets,
+                                     unsigned worker, void *arg);
+
+/** Scan a clustered index in a consistent read by multiple threads.
+The key space is partitioned by the node pointer records of the upper
+levels of the index tree, and the ranges are scanned by srv_thread_pool
+workers and the calling thread, all using trx->read_view.
+@param index      clustered index
+@param trx        transaction whose read view is open
+@param n_workers  maximum number of concurrent scans
+@param callback   function to invoke on each visible record that is not
+                  delete-marked; invoked concurrently by different workers
+@param arg        argument to callback
+@return error code
+@retval DB_INTERRUPTED if the scan was interrupted or callback returned
+false */
+dberr_t row_parallel_scan(dict_index_t *index, trx_t *trx, unsigned n_workers,
+                          row_pread_callback_t callback, void *arg);
+
+/** Count the records of a clustered index in a consistent read.
+@param index      clustered index
+@param trx        transaction whose read view is open
+@param n_workers  maximum number of concurrent scans
+@param n_rows     number of records that are visible in trx->read_view
+@return error code */
+dberr_t row_count_parallel(dict_index_t *index, trx_t *trx, unsigned n_workers,
+                           ulint *n_rows);
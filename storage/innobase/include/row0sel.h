@@ -57,6 +57,9 @@ void
 sel_col_prefetch_buf_free(
 /*======================*/
 	sel_buf_t*	prefetch_buf);	/*!< in, own: prefetch buffer */
+/** Free the row_prebuilt_t::fetch_cache.
+@param prebuilt  prebuilt struct */
+void row_sel_prefetch_cache_free(row_prebuilt_t *prebuilt);
 /**********************************************************************//**
 Performs a select step. This is a high-level function used in SQL execution
 graphs.
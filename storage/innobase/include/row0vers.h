@@ -96,6 +96,11 @@ row_vers_build_cur_vrow(
 	mem_heap_t*		v_heap,
 	mtr_t*			mtr);
 
+/** Create the cache of old record versions for consistent reads. */
+void row_vers_cache_create() noexcept;
+/** Free the cache of old record versions for consistent reads. */
+void row_vers_cache_close() noexcept;
+
 /*****************************************************************//**
 Constructs the version of a clustered index record which a consistent
 read should see. We assume that the trx id stored in rec is such that
@@ -170,6 +170,12 @@ extern my_bool	srv_file_per_table;
 
 /** Sort buffer size in index creation */
 extern ulong	srv_sort_buf_size;
+/** Maximum number of threads for merging sorted runs in index creation
+(innodb_merge_sort_threads) */
+extern ulong	srv_merge_sort_threads;
+/** Maximum number of rows to prefetch for a consistent read
+(innodb_fetch_cache_rows) */
+extern uint	srv_fetch_cache_rows;
 /** Maximum modification log file size for online index creation */
 extern unsigned long long	srv_online_max_size;
 
@@ -182,9 +188,15 @@ extern my_bool	srv_use_native_aio;
 #ifdef __linux__
 /* This enum is defined which linux native io method to use */
 extern ulong	srv_linux_aio_method;
+/** innodb_io_uring_sqpoll */
+extern my_bool	srv_io_uring_sqpoll;
+/** innodb_io_uring_fixed */
+extern my_bool	srv_io_uring_fixed;
 #endif
 
 extern my_bool	srv_numa_interleave;
+/** innodb_numa_partition */
+extern my_bool	srv_numa_partition;
 
 /* Use atomic writes i.e disable doublewrite buffer */
 extern my_bool srv_use_atomic_writes;
@@ -225,6 +237,18 @@ extern char*	srv_log_group_home_dir;
 at startup (while disallowing writes to the redo log). */
 extern ulonglong	srv_log_file_size;
 extern ulong	srv_flush_log_at_trx_commit;
+/** innodb_log_compress: whether to write WRITE_COMPRESSED records */
+extern my_bool	srv_log_compress;
+/** innodb_log_checkpoint_dirty_pages: maximum number of page identifiers
+to write to LOG_DIRTY_PAGES_FILE_NAME after each checkpoint (0=disable) */
+extern ulong	srv_log_checkpoint_dirty_pages;
+/** innodb_log_archive_dir: where to copy each lap of ib_logfile0, or NULL */
+extern char*	srv_log_archive_dir;
+/** innodb_log_archive_files: maximum number of files to keep in
+innodb_log_archive_dir (0=unlimited) */
+extern ulong	srv_log_archive_files;
+/** Minimum length of a WRITE payload for innodb_log_compress=ON */
+constexpr size_t LOG_COMPRESS_MIN_LEN= 256;
 extern uint	srv_flush_log_at_timeout;
 extern my_bool	srv_adaptive_flushing;
 extern my_bool	srv_flush_sync;
@@ -242,8 +266,11 @@ extern ulint	srv_lock_table_size;
 extern ulong	srv_checksum_algorithm;
 extern my_bool	srv_random_read_ahead;
 extern ulong	srv_read_ahead_threshold;
+extern uint	srv_read_ahead_scan_pages;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
+/** innodb_recovery_threads */
+extern uint	srv_n_recovery_threads;
 
 /* Number of IO operations per second the server can do */
 extern ulong    srv_io_capacity;
@@ -292,6 +319,7 @@ extern my_bool	srv_force_primary_key;
 extern my_bool	innodb_alter_copy_bulk;
 extern ulong	srv_max_purge_lag;
 extern ulong	srv_max_purge_lag_delay;
+extern my_bool	srv_max_purge_lag_per_table;
 
 extern my_bool	innodb_encrypt_temporary_tables;
 
@@ -361,6 +389,13 @@ extern uint srv_n_purge_threads;
 /* the number of pages to purge in one batch */
 extern ulong srv_purge_batch_size;
 
+/** innodb_purge_read_ahead */
+extern my_bool srv_purge_read_ahead;
+
+/** innodb_undo_version_cache_size; the size of the cache of old
+record versions for consistent reads, in bytes */
+extern ulong srv_undo_version_cache_size;
+
 /* print all user-level transactions deadlocks to mysqld stderr */
 extern my_bool srv_print_all_deadlocks;
 
@@ -613,7 +648,7 @@ struct export_var_t{
 	uint64_t innodb_row_lock_time_max;	/*!< srv_n_lock_max_wait_time */
 
 	/** Number of undo tablespace truncation operations */
-	ulong innodb_undo_truncations;
+	Atomic_counter<ulint> innodb_undo_truncations;
 
 	/** Number of instant ALTER TABLE operations that affect columns */
 	Atomic_counter<ulint> innodb_instant_alter_column;
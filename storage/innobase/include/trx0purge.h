@@ -45,8 +45,12 @@ trx_purge_add_undo_to_history(const trx_t* trx, trx_undo_t*& undo, mtr_t* mtr);
 Remove unnecessary history data from rollback segments. NOTE that when this
 function is called, the caller (purge_coordinator_callback)
 must not have any latches on undo log pages!
-*/
-void trx_purge_truncate_history();
+@return whether trx_purge_truncate_rebuild() must be invoked */
+bool trx_purge_truncate_history();
+
+/** Re-initialize the undo tablespace purge_sys.truncate_undo_space.current
+after trx_purge_truncate_history() found it to be free of history. */
+void trx_purge_truncate_rebuild();
 
 /**
 Run a purge batch.
@@ -56,6 +60,15 @@ Run a purge batch.
 @return number of undo log pages handled in the batch */
 ulint trx_purge(trx_t *trx, ulint n_tasks, ulint history_size) noexcept;
 
+/** Determine the innodb_max_purge_lag_per_table=ON delay for DML.
+@param id     table identifier
+@param delay  srv_dml_needed_delay
+@return the delay for modifying the table, in microseconds */
+ulint trx_purge_dml_delay(table_id_t id, ulint delay) noexcept;
+
+/** Forget the tables of innodb_max_purge_lag_per_table. */
+void trx_purge_clear_lagging() noexcept;
+
 /** The control structure used in the purge operation */
 class purge_sys_t
 {
@@ -191,6 +204,12 @@ class purge_sys_t
   @retval nullptr in case the page is corrupted */
   buf_block_t *get_page(page_id_t id, trx_t *trx);
 
+  /** Read an undo log page of purge_sys.rseg asynchronously,
+  unless it has already been processed in this batch.
+  @param page_no  undo page number, or FIL_NULL
+  @param trx      transaction attached to current_thd */
+  void read_ahead(uint32_t page_no, trx_t *trx) noexcept;
+
 	que_t*		query;		/*!< The query graph which will do the
 					parallelized purge operation */
 
@@ -274,13 +293,17 @@ class purge_sys_t
   void queue_unlock() { mysql_mutex_unlock(&pq_mutex); }
 
   /** innodb_undo_log_truncate=ON state;
-  only modified by purge_coordinator_callback() */
+  only modified by purge_coordinator_callback(), or by
+  trx_purge_truncate_rebuild() while rebuild is set */
   struct {
     /** The undo tablespace that is currently being truncated */
     Atomic_relaxed<fil_space_t*> current;
     /** The number of the undo tablespace that was last truncated,
     relative from srv_undo_space_id_start */
     uint32_t last;
+    /** whether current has been drained and is waiting for
+    trx_purge_truncate_rebuild() */
+    std::atomic<bool> rebuild;
   } truncate_undo_space;
 
   /** Create the instance */
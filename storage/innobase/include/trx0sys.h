@@ -870,6 +870,16 @@ class trx_sys_t
   alignas(CPU_LEVEL1_DCACHE_LINESIZE)
   std::atomic<trx_id_t> m_rw_trx_hash_version;
 
+  /**
+    Incremented after a transaction has been removed from rw_trx_hash.
+    Together with m_max_trx_id, this allows ReadView::open() to detect
+    that rw_trx_hash has not changed since a snapshot was taken.
+
+    @sa deregister_rw()
+    @sa get_rw_trx_hash_erases()
+  */
+  std::atomic<uint64_t> m_rw_trx_hash_erases;
+
 
   bool m_initialised;
 
@@ -1181,6 +1191,21 @@ class trx_sys_t
   void deregister_rw(trx_t *trx)
   {
     rw_trx_hash.erase(trx);
+    m_rw_trx_hash_erases.fetch_add(1, std::memory_order_release);
+  }
+
+
+  /**
+    Getter for m_rw_trx_hash_erases, must issue ACQUIRE memory barrier.
+
+    If this is invoked before snapshot_ids() and returns the same value
+    later, while get_max_trx_id() remains equal to the snapshot's
+    max_trx_id, then the snapshot is still current: no transaction has
+    been registered, assigned a serialisation number or deregistered.
+  */
+  uint64_t get_rw_trx_hash_erases() const
+  {
+    return m_rw_trx_hash_erases.load(std::memory_order_acquire);
   }
 
 
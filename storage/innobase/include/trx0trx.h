@@ -376,6 +376,11 @@ struct trx_lock_t
   must be protected by trx->mutex.) */
   trx_lock_list_t trx_locks;
 
+  /** Record locks that were removed by lock_rec_discard() and whose memory
+  (including the bitmap) can be reused by lock_rec_create_low() for any page.
+  Linked via lock_t::trx_locks and protected like trx_locks. */
+  trx_lock_list_t free_rec_locks;
+
 	lock_list	table_locks;	/*!< All table locks requested by this
 					transaction, including AUTOINC locks */
 
@@ -409,6 +414,8 @@ class trx_mod_table_time_t
   /** First modification of a system versioned column
   (NONE= no versioning, BULK= the table was dropped) */
   undo_no_t first_versioned= NONE;
+  /** Whether dict_table_t::n_active_modifiers was incremented */
+  bool active_modifier= false;
 #ifdef UNIV_DEBUG
   /** Whether the modified table is a FTS auxiliary table */
   bool fts_aux_table= false;
@@ -430,6 +437,31 @@ class trx_mod_table_time_t
   bool valid(undo_no_t rows= NONE) const
   { auto f= first & LIMIT; return f <= first_versioned && f <= rows; }
 #endif /* UNIV_DEBUG */
+  /** Note that the transaction may hold implicit locks on the table.
+  This must be invoked before any record is modified.
+  @param table  the table that is being modified */
+  void start_modifying(dict_table_t *table)
+  {
+    if (!active_modifier && !table->is_temporary())
+    {
+      active_modifier= true;
+      table->n_active_modifiers++;
+    }
+  }
+
+  /** Note that the transaction no longer holds implicit locks on the table,
+  because it was committed or the changes were rolled back.
+  @param table  the table that was being modified */
+  void stop_modifying(dict_table_t *table)
+  {
+    if (active_modifier)
+    {
+      active_modifier= false;
+      ut_ad(table->n_active_modifiers);
+      table->n_active_modifiers--;
+    }
+  }
+
   /** @return if versioned columns were modified */
   bool is_versioned() const { return (~first_versioned & LIMIT) != 0; }
   /** @return if the table was dropped */
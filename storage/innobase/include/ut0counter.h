@@ -30,6 +30,9 @@ Created 2012/04/12 by Sunny Bains
 
 #include "univ.i"
 #include "my_rdtsc.h"
+#ifdef HAVE_SCHED_GETCPU
+# include <sched.h>
+#endif
 
 /** Atomic which occupies whole CPU cache line.
 Note: We rely on the default constructor of std::atomic and
@@ -66,7 +69,7 @@ struct ib_counter_t {
 
 	/** Add to the counter.
 	@param[in]	n	amount to be added */
-	void add(Type n) { add(size_t(my_pseudo_random()), n); }
+	void add(Type n) { add(default_index(), n); }
 
 	/** Add to the counter.
 	@param[in]	index	a reasonably thread-unique identifier
@@ -91,6 +94,20 @@ struct ib_counter_t {
 	}
 
 private:
+	/** @return the slot index for add(Type): the current CPU, so that
+	the slots of different CPUs stay in different cache lines, or a
+	pseudo-random number if the CPU is not known */
+	static size_t default_index()
+	{
+#ifdef HAVE_SCHED_GETCPU
+		int cpu = sched_getcpu();
+		if (cpu >= 0) {
+			return size_t(cpu);
+		}
+#endif
+		return size_t(my_pseudo_random());
+	}
+
 	static_assert(sizeof(Element<Type>) == CPU_LEVEL1_DCACHE_LINESIZE, "");
 	/** Array of counter elements */
 	alignas(CPU_LEVEL1_DCACHE_LINESIZE) Element<Type> m_counter[N];
@@ -867,6 +867,7 @@ constexpr const char* const auto_event_names[] =
   "lexyy",
   "lock0lock",
   "mem0mem",
+  "mtr0mtr",
   "os0file",
   "pars0lex",
   "rem0rec",
@@ -876,6 +877,7 @@ constexpr const char* const auto_event_names[] =
   "row0merge",
   "row0mysql",
   "row0sel",
+  "row0vers",
   "srv0start",
   "trx0i_s",
   "trx0i_s",
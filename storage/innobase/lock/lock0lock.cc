@@ -63,6 +63,12 @@ const conflicting_lock_info null_c_lock_info{nullptr, nullptr, ut_d(nullptr)};
 my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 ulong innodb_deadlock_report;
+/** The value of innodb_deadlock_check_depth */
+uint innodb_deadlock_check_depth;
+
+/** How many seconds lock_wait() waits before repeating a deadlock check
+that was cut short by innodb_deadlock_check_depth */
+static constexpr time_t DEADLOCK_CHECK_DEFERRED_SEC= 1;
 
 #if defined(UNIV_DEBUG) || \
     defined(INNODB_ENABLE_XAP_UNLOCK_UNMODIFIED_FOR_PRIMARY)
@@ -301,16 +307,22 @@ namespace Deadlock
   Resolve a deadlock by choosing a transaction that will be rolled back.
   @param trx        transaction requesting a lock
   @param wait_lock  the lock being requested
+  @param depth      maximum number of waits-for edges to traverse
+                    (0=unlimited)
+  @param deferred   set to whether the check was cut short by depth
   @return the lock that trx is or was waiting for
   @retval nullptr if the lock wait was resolved
   @retval -1 if trx must report DB_DEADLOCK */
-  static lock_t *check_and_resolve(trx_t *trx, lock_t *wait_lock);
+  static lock_t *check_and_resolve(trx_t *trx, lock_t *wait_lock,
+                                   unsigned depth, bool &deferred);
 
   /** Quickly detect a deadlock using Brent's cycle detection algorithm.
   @param trx     transaction that is waiting for another transaction
+  @param depth   maximum number of waits-for edges to traverse (0=unlimited)
   @return a transaction that is part of a cycle
-  @retval nullptr if no cycle was found */
-  inline trx_t *find_cycle(trx_t *trx)
+  @retval nullptr if no cycle was found
+  @retval -1 if the search was cut short by depth */
+  inline trx_t *find_cycle(trx_t *trx, unsigned depth= 0)
   {
     mysql_mutex_assert_owner(&lock_sys.wait_mutex);
     trx_t *tortoise= trx, *hare= trx;
@@ -326,6 +338,8 @@ namespace Deadlock
         cycle. In that case, our victim will not be trx. */
         return hare;
       }
+      if (depth && !--depth)
+        return reinterpret_cast<trx_t*>(-1);
       if (l == power)
       {
         /* The maximum concurrent number of TRX_STATE_ACTIVE transactions
@@ -1306,6 +1320,13 @@ lock_sec_rec_some_has_impl(
   ut_ad(rec_offs_validate(rec, index, offsets));
   ut_ad(!rec_is_metadata(rec, *index));
 
+  /* If no active transaction has modified the table, no record can be
+  implicitly locked. Any transaction that modified this page must have
+  registered itself before the page was modified, and the page latch
+  that we are holding makes that registration visible to us. */
+  if (!index->table->n_active_modifiers)
+    return nullptr;
+
   const trx_id_t max_trx_id= page_get_max_trx_id(page_align(rec));
 
   /* Note: It is possible to have caller_trx->id == 0 in a locking read
@@ -1523,9 +1544,16 @@ lock_rec_create(
 	ut_ad(trx->state != TRX_STATE_NOT_STARTED);
 
 	auto cached_bytes = sizeof *trx->lock.rec_pool - sizeof *lock;
-
-	if (trx->lock.rec_cached >= UT_ARR_SIZE(trx->lock.rec_pool)
-	    || n_bytes > cached_bytes) {
+	lock = UT_LIST_GET_FIRST(trx->lock.free_rec_locks);
+
+	if (lock && !(type_mode & (LOCK_PREDICATE | LOCK_PRDT_PAGE))
+	    && n_bytes <= lock->un_member.rec_lock.n_bits / 8) {
+		/* Reuse a lock that was discarded with its page, and
+		all of its bitmap. */
+		UT_LIST_REMOVE(trx->lock.free_rec_locks, lock);
+		n_bytes = lock->un_member.rec_lock.n_bits / 8;
+	} else if (trx->lock.rec_cached >= UT_ARR_SIZE(trx->lock.rec_pool)
+		   || n_bytes > cached_bytes) {
 		n_bytes += LOCK_PAGE_DEFAULT_BITMAP_SIZE;
 		lock = static_cast<lock_t*>(
 			mem_heap_alloc(trx->lock.lock_heap,
@@ -2298,6 +2326,12 @@ dberr_t lock_wait(que_thr_t *thr)
   thd_wait_begin(trx->mysql_thd, (type_mode & LOCK_TABLE)
                  ? THD_WAIT_TABLE_LOCK : THD_WAIT_ROW_LOCK);
 
+  /* Whether the deadlock check was cut short by
+  innodb_deadlock_check_depth. If so, this thread will repeat it
+  without a limit after waiting for DEADLOCK_CHECK_DEFERRED_SEC. */
+  bool deadlock_deferred= false;
+  timespec deadlock_time;
+
   mysql_mutex_lock(&lock_sys.wait_mutex);
   /* Now that we are holding lock_sys.wait_mutex, we must reload
   trx->lock.wait_mutex. It cannot be cleared as long as we are holding
@@ -2324,7 +2358,9 @@ dberr_t lock_wait(que_thr_t *thr)
       goto abort_wait;
     }
 
-    wait_lock= Deadlock::check_and_resolve(trx, wait_lock);
+    wait_lock= Deadlock::check_and_resolve(trx, wait_lock,
+                                           innodb_deadlock_check_depth,
+                                           deadlock_deferred);
 
     if (wait_lock == reinterpret_cast<lock_t*>(-1))
     {
@@ -2373,7 +2409,35 @@ dberr_t lock_wait(que_thr_t *thr)
 
     DEBUG_SYNC_C("lock_wait_before_suspend");
 
-    if (no_timeout)
+    if (deadlock_deferred)
+    {
+      set_timespec_time_nsec(deadlock_time, suspend_time.val * 1000);
+      deadlock_time.MY_tv_sec+= DEADLOCK_CHECK_DEFERRED_SEC;
+      const bool timeout= !no_timeout &&
+        cmp_timespec(deadlock_time, abstime) >= 0;
+      err= my_cond_timedwait(&trx->lock.cond, &lock_sys.wait_mutex.m_mutex,
+                             timeout ? &abstime : &deadlock_time);
+      if (err && !timeout)
+      {
+        err= 0;
+        if (trx->lock.wait_lock && trx->error_state == DB_SUCCESS)
+        {
+          /* Complete the deadlock check of our own wait without a
+          depth limit, holding only lock_sys.wait_mutex, like
+          at the start of the wait above. */
+          wait_lock= Deadlock::check_and_resolve(trx, trx->lock.wait_lock,
+                                                 0, deadlock_deferred);
+          if (wait_lock == reinterpret_cast<lock_t*>(-1))
+          {
+            trx->error_state= DB_DEADLOCK;
+            wait_lock= trx->lock.wait_lock;
+            break;
+          }
+          continue;
+        }
+      }
+    }
+    else if (no_timeout)
     {
       my_cond_wait(&trx->lock.cond, &lock_sys.wait_mutex.m_mutex);
       err= 0;
@@ -2613,7 +2677,8 @@ static void lock_rec_dequeue_from_page(lock_t *in_lock, bool owns_wait_mutex)
 	}
 }
 
-/** Remove a record lock request, waiting or granted, on a discarded page
+/** Remove a record lock request, waiting or granted, on a discarded page.
+A granted record lock will be added to trx->lock.free_rec_locks for reuse.
 @param in_lock  lock object
 @param cell     hash table cell containing in_lock */
 TRANSACTIONAL_TARGET
@@ -2629,6 +2694,10 @@ void lock_rec_discard(lock_t *in_lock, hash_cell_t &cell) noexcept
     ut_d(old_locks=)
     in_lock->index->table->n_rec_locks--;
     UT_LIST_REMOVE(trx->lock.trx_locks, in_lock);
+    /* Predicate locks carry a lock_prdt_t instead of a bitmap.
+    A waiting lock may still be pointed to by trx->lock.wait_lock. */
+    if (!(in_lock->type_mode & (LOCK_PREDICATE | LOCK_PRDT_PAGE | LOCK_WAIT)))
+      UT_LIST_ADD_FIRST(trx->lock.free_rec_locks, in_lock);
   }
   ut_ad(old_locks);
   MONITOR_INC(MONITOR_RECLOCK_REMOVED);
@@ -5128,7 +5197,12 @@ void lock_release_on_prepare(trx_t *trx)
 ATTRIBUTE_COLD
 void lock_release_on_rollback(trx_t *trx, dict_table_t *table)
 {
-  trx->mod_tables.erase(table);
+  auto i= trx->mod_tables.find(table);
+  if (i != trx->mod_tables.end())
+  {
+    i->second.stop_modifying(table);
+    trx->mod_tables.erase(i);
+  }
 
   /* This is very rarely executed code, in the rare case that an
   CREATE TABLE operation is being rolled back. Theoretically,
@@ -7330,7 +7404,8 @@ Resolve a deadlock by choosing a transaction that will be rolled back.
 @return the lock that trx is or was waiting for
 @retval nullptr if the lock wait was resolved
 @retval -1 if trx must report DB_DEADLOCK */
-static lock_t *Deadlock::check_and_resolve(trx_t *trx, lock_t *wait_lock)
+static lock_t *Deadlock::check_and_resolve(trx_t *trx, lock_t *wait_lock,
+                                           unsigned depth, bool &deferred)
 {
   mysql_mutex_assert_owner(&lock_sys.wait_mutex);
 
@@ -7342,8 +7417,18 @@ static lock_t *Deadlock::check_and_resolve(trx_t *trx, lock_t *wait_lock)
   if (!innodb_deadlock_detect)
     return wait_lock;
 
-  if (UNIV_LIKELY_NULL(find_cycle(trx)))
+  deferred= false;
+
+  if (trx_t *cycle= find_cycle(trx, depth))
   {
+    if (cycle == reinterpret_cast<trx_t*>(-1))
+    {
+      /* The waits-for path is longer than depth. lock_wait() will
+      repeat the check without a limit if the wait lasts longer. */
+      deferred= true;
+      return wait_lock;
+    }
+
     if (report(trx, true) == trx)
       return reinterpret_cast<lock_t*>(-1);
     /* Because report() released and reacquired lock_sys.wait_mutex,
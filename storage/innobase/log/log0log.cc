@@ -46,6 +46,7 @@ Created 12/9/1995 Heikki Tuuri
 #include "log0sync.h"
 #include "log.h"
 #include "tpool.h"
+#include <my_dir.h>
 
 /*
 General philosophy of InnoDB redo-logs:
@@ -62,6 +63,389 @@ static group_commit_lock write_lock;
 /** Redo log system */
 log_t	log_sys;
 
+/** @return the name of an innodb_log_archive_dir file
+@param lsn  log sequence number at log_sys.START_OFFSET */
+static std::string log_archive_path(lsn_t lsn)
+{
+  char name[sizeof "/ib_archive_" + 20];
+  snprintf(name, sizeof name, "/ib_archive_%020" PRIu64, uint64_t{lsn});
+  return std::string{srv_log_archive_dir}.append(name);
+}
+
+/** Open an innodb_log_archive_dir file.
+@param path      file name
+@param create    whether to create the file
+@param read_only whether the file is only going to be read
+@param success   whether the operation succeeded
+@return the file handle */
+static os_file_t log_archive_open(const char *path, bool create,
+                                  bool read_only, bool *success)
+{
+  return os_file_create_func(path,
+                             create ? OS_FILE_CREATE : OS_FILE_OPEN_SILENT,
+#if defined _WIN32 || defined O_DIRECT
+                             OS_DATA_FILE_NO_O_DIRECT,
+#else
+                             OS_DATA_FILE,
+#endif
+                             read_only, success);
+}
+
+/** Layout of the block at log_t::CHECKPOINT_1 of an archive file */
+enum log_archive_end
+{
+  /** the log sequence number at log_t::START_OFFSET */
+  LOG_ARCHIVE_LAP_LSN= 0,
+  /** the log sequence number up to which the file is durable */
+  LOG_ARCHIVE_END_LSN= 8,
+  /** CRC-32C of the preceding bytes */
+  LOG_ARCHIVE_END_CRC= 60,
+  /** the size of the block */
+  LOG_ARCHIVE_END_SIZE= 512
+};
+
+/** Determine the valid contents of an archive file.
+@param file  archive file
+@param lsn   the log sequence number at log_sys.START_OFFSET
+@return the log sequence number up to which file is durable
+@retval 0 if the file is corrupted */
+static lsn_t log_archive_end_lsn(os_file_t file, lsn_t lsn) noexcept
+{
+  byte b[LOG_ARCHIVE_END_SIZE];
+  if (os_file_read_func(IORequestRead, file, b, 0, sizeof b, nullptr) !=
+      DB_SUCCESS ||
+      mach_read_from_4(b + 508) != my_crc32c(0, b, 508) ||
+      mach_read_from_8(b + LOG_HEADER_START_LSN) != lsn ||
+      os_file_read_func(IORequestRead, file, b, log_sys.CHECKPOINT_1,
+                        sizeof b, nullptr) != DB_SUCCESS ||
+      mach_read_from_4(b + LOG_ARCHIVE_END_CRC) !=
+      my_crc32c(0, b, LOG_ARCHIVE_END_CRC) ||
+      mach_read_from_8(b + LOG_ARCHIVE_LAP_LSN) != lsn)
+    return 0;
+  const lsn_t end_lsn{mach_read_from_8(b + LOG_ARCHIVE_END_LSN)};
+  return end_lsn >= lsn ? end_lsn : 0;
+}
+
+static void log_archive_run(void *);
+/** the task that writes to innodb_log_archive_dir */
+static tpool::task_group log_archive_task_group(1);
+static tpool::waitable_task log_archive_task(log_archive_run, nullptr,
+                                             &log_archive_task_group);
+
+/** Copy of the circular ib_logfile0 in innodb_log_archive_dir.
+Each lap of ib_logfile0 is archived in a separate file that is named
+after the LSN at log_sys.START_OFFSET. The file has the same layout as
+ib_logfile0, but it will not wrap around. Instead of checkpoints, the
+block at log_sys.CHECKPOINT_1 contains the LSN up to which the file has
+been durably written.
+
+log_write_buf() only copies the data to a buffer, which
+log_archive_task writes to the archive. A log write will wait only if
+the archive falls behind by more than the size of the buffer.
+When a new file is created, the oldest files beyond
+innodb_log_archive_files are deleted. */
+static class log_archive_t
+{
+  /** A write to ib_logfile0 */
+  struct write_t
+  {
+    /** log sequence number at offset */
+    lsn_t lsn;
+    /** log sequence number at the end of the records */
+    lsn_t end_lsn;
+    /** ib_logfile0 offset */
+    lsn_t offset;
+    /** length of the write, in bytes */
+    size_t length;
+  };
+
+  /** protects buf, used, writes, scheduled, failed */
+  mysql_mutex_t mutex;
+  /** signalled when buf has been handed over to log_archive_task */
+  pthread_cond_t cond;
+  /** the data of writes */
+  byte *buf= nullptr;
+  /** the data of writing; only accessed by log_archive_task */
+  byte *write_buf= nullptr;
+  /** size of buf and write_buf, in bytes */
+  size_t capacity= 0;
+  /** number of bytes used in buf */
+  size_t used= 0;
+  /** the writes that have not been submitted to log_archive_task */
+  std::vector<write_t> writes;
+  /** the writes being archived by log_archive_task */
+  std::vector<write_t> writing;
+  /** whether log_archive_task has been submitted */
+  bool scheduled= false;
+  /** whether archiving was disabled due to an error */
+  bool failed= false;
+
+  /** the current archive file; only accessed by log_archive_task */
+  os_file_t file= OS_FILE_CLOSED;
+  /** the log sequence number at log_sys.START_OFFSET of file */
+  lsn_t lap_lsn= 0;
+  /** the log sequence number up to which file is contiguous */
+  lsn_t end_lsn= 0;
+
+  /** Delete the oldest archive files beyond innodb_log_archive_files */
+  void purge() noexcept
+  {
+    if (!srv_log_archive_files)
+      return;
+    MY_DIR *dir= my_dir(srv_log_archive_dir, MYF(0));
+    if (!dir)
+      return;
+    std::vector<std::string> names;
+    for (size_t i= 0; i < dir->number_of_files; i++)
+    {
+      const char *name= dir->dir_entry[i].name;
+      if (strlen(name) == sizeof "ib_archive_" - 1 + 20 &&
+          !memcmp(name, "ib_archive_", sizeof "ib_archive_" - 1))
+        names.emplace_back(name);
+    }
+    my_dirend(dir);
+    if (names.size() <= srv_log_archive_files)
+      return;
+    /* The LSN in the name is zero-padded; the oldest files sort first. */
+    std::sort(names.begin(), names.end());
+    names.resize(names.size() - srv_log_archive_files);
+    for (const std::string &name : names)
+      os_file_delete_if_exists_func(std::string{srv_log_archive_dir}.
+                                    append("/").append(name).c_str(),
+                                    nullptr);
+  }
+
+  /** Open or create an archive file.
+  @param lsn  log sequence number at log_sys.START_OFFSET
+  @return whether the file was opened */
+  bool open(lsn_t lsn) noexcept
+  {
+    ut_ad(file == OS_FILE_CLOSED);
+    const std::string path{log_archive_path(lsn)};
+    bool success;
+    /* After a restart, the current lap may already exist in part. */
+    file= log_archive_open(path.c_str(), false, false, &success);
+    if (!success)
+    {
+      file= log_archive_open(path.c_str(), true, false, &success);
+      if (!success)
+        return false;
+      byte *hdr= static_cast<byte*>(aligned_malloc(log_sys.START_OFFSET,
+                                                   4096));
+      memset_aligned<4096>(hdr, 0, log_sys.START_OFFSET);
+      log_t::header_write(hdr, lsn, log_sys.is_encrypted());
+      success= os_file_write_func(IORequestWrite, path.c_str(), file, hdr,
+                                  0, log_sys.START_OFFSET) == DB_SUCCESS;
+      aligned_free(hdr);
+      if (!success)
+      {
+        os_file_close_func(file);
+        file= OS_FILE_CLOSED;
+        return false;
+      }
+      purge();
+      end_lsn= lsn;
+    }
+    else
+      end_lsn= std::max(log_archive_end_lsn(file, lsn), lsn);
+    lap_lsn= lsn;
+    return true;
+  }
+
+  /** Make the data of the current file durable, and write end_lsn
+  to the block at log_sys.CHECKPOINT_1.
+  @return whether the end_lsn was written */
+  bool sync() noexcept
+  {
+    ut_ad(file != OS_FILE_CLOSED);
+    if (!os_file_flush_func(file))
+      return false;
+    byte b[LOG_ARCHIVE_END_SIZE]{};
+    mach_write_to_8(b + LOG_ARCHIVE_LAP_LSN, lap_lsn);
+    mach_write_to_8(b + LOG_ARCHIVE_END_LSN, end_lsn);
+    mach_write_to_4(b + LOG_ARCHIVE_END_CRC,
+                    my_crc32c(0, b, LOG_ARCHIVE_END_CRC));
+    return os_file_write_func(IORequestWrite, srv_log_archive_dir, file,
+                              b, log_sys.CHECKPOINT_1,
+                              sizeof b) == DB_SUCCESS;
+  }
+
+  /** Durably write and close the current archive file.
+  @return whether the file was written successfully */
+  bool close_file() noexcept
+  {
+    if (file == OS_FILE_CLOSED)
+      return true;
+    const bool success{sync() && os_file_flush_func(file)};
+    os_file_close_func(file);
+    file= OS_FILE_CLOSED;
+    return success;
+  }
+
+  /** Write writing and write_buf to the archive.
+  @return whether the writes succeeded */
+  bool archive() noexcept
+  {
+    const byte *b= write_buf;
+    for (const write_t &w : writing)
+    {
+      const lsn_t lsn{w.lsn - (w.offset - log_sys.START_OFFSET)};
+      if (lsn != lap_lsn || file == OS_FILE_CLOSED)
+        if (!close_file() || !open(lsn))
+          return false;
+      if (os_file_write_func(IORequestWrite, srv_log_archive_dir, file,
+                             b, w.offset, w.length) != DB_SUCCESS)
+        return false;
+      /* If the start of the lap is missing from the archive (it was
+      not archived before a restart, or archiving was enabled in the
+      middle of the lap), end_lsn will not advance, and
+      log_archive_read() will not be able to read the lap. */
+      if (w.lsn <= end_lsn)
+        end_lsn= std::max(end_lsn, w.end_lsn);
+      b+= w.length;
+    }
+    return file == OS_FILE_CLOSED || sync();
+  }
+
+public:
+  void create() noexcept
+  {
+    mysql_mutex_init(PSI_NOT_INSTRUMENTED, &mutex, nullptr);
+    pthread_cond_init(&cond, nullptr);
+  }
+
+  /** Write the buffered writes to the archive; invoked by log_archive_task */
+  void run() noexcept
+  {
+    mysql_mutex_lock(&mutex);
+    while (!writes.empty())
+    {
+      std::swap(buf, write_buf);
+      std::swap(writes, writing);
+      used= 0;
+      pthread_cond_broadcast(&cond);
+      mysql_mutex_unlock(&mutex);
+      const bool success{archive()};
+      writing.clear();
+      mysql_mutex_lock(&mutex);
+      if (!success)
+      {
+        sql_print_error("InnoDB: Failed to write to innodb_log_archive_dir;"
+                        " redo log archiving is disabled");
+        close_file();
+        failed= true;
+        writes.clear();
+        used= 0;
+        pthread_cond_broadcast(&cond);
+      }
+    }
+    scheduled= false;
+    mysql_mutex_unlock(&mutex);
+  }
+
+  /** Buffer a write to ib_logfile0 for log_archive_task.
+  @param b        data that was written
+  @param length   length of the data
+  @param offset   ib_logfile0 offset
+  @param lsn      log sequence number at offset
+  @param end      log sequence number at the end of the log records */
+  void write(const byte *b, size_t length, lsn_t offset, lsn_t lsn,
+             lsn_t end) noexcept
+  {
+    ut_ad(write_lock.is_owner());
+    ut_ad(offset >= log_sys.START_OFFSET);
+    mysql_mutex_lock(&mutex);
+    if (UNIV_UNLIKELY(!capacity))
+    {
+      capacity= std::max(size_t{2} * log_sys.buf_size, length);
+      buf= static_cast<byte*>(aligned_malloc(capacity, 4096));
+      write_buf= static_cast<byte*>(aligned_malloc(capacity, 4096));
+    }
+    ut_ad(length <= capacity);
+    /* Wait if log_archive_task is falling behind. */
+    while (!failed && used + length > capacity)
+      my_cond_wait(&cond, &mutex.m_mutex);
+    if (!failed)
+    {
+      memcpy(buf + used, b, length);
+      used+= length;
+      writes.emplace_back(write_t{lsn, end, offset, length});
+      if (!scheduled)
+      {
+        scheduled= true;
+        srv_thread_pool->submit_task(&log_archive_task);
+      }
+    }
+    mysql_mutex_unlock(&mutex);
+  }
+
+  /** Write all buffered writes and close the archive */
+  void close() noexcept
+  {
+    if (!capacity)
+      return;
+    log_archive_task.wait();
+    /* Any writes were completed by the task before it finished. */
+    ut_ad(writes.empty());
+    close_file();
+    aligned_free(buf);
+    aligned_free(write_buf);
+    buf= write_buf= nullptr;
+    capacity= 0;
+  }
+
+  void destroy() noexcept
+  {
+    ut_ad(!capacity);
+    mysql_mutex_destroy(&mutex);
+    pthread_cond_destroy(&cond);
+  }
+} log_archive;
+
+static void log_archive_run(void *) { log_archive.run(); }
+
+size_t log_archive_read(lsn_t lsn, byte *buf, size_t size) noexcept
+{
+  ut_ad(srv_log_archive_dir);
+  ut_ad(!(size & (log_sys.write_size - 1)));
+  size_t total= 0;
+
+  while (size)
+  {
+    const lsn_t offset{log_sys.calc_lsn_offset(lsn)};
+    const lsn_t lap_lsn{lsn - (offset - log_sys.START_OFFSET)};
+    bool success;
+    os_file_t file= log_archive_open(log_archive_path(lap_lsn).c_str(),
+                                     false, true, &success);
+    if (!success)
+      break;
+
+    /* Only read complete blocks that were durably written.
+    The tail of the current lap may not have been archived yet. */
+    const lsn_t end_lsn{log_archive_end_lsn(file, lap_lsn)};
+    const lsn_t end{std::min<lsn_t>(log_sys.file_size, log_sys.START_OFFSET +
+                                    (end_lsn - lap_lsn))};
+    size_t n{0};
+    if (end_lsn && end > offset)
+      n= size_t(std::min<lsn_t>(end - offset, size)) &
+        ~size_t{log_sys.write_size - 1};
+    if (n && os_file_read_func(IORequestRead, file, buf, offset, n,
+                               nullptr) != DB_SUCCESS)
+      n= 0;
+    os_file_close_func(file);
+    if (!n)
+      break;
+    total+= n;
+    buf+= n;
+    size-= n;
+    lsn+= n;
+    if (offset + n < log_sys.file_size)
+      break;
+  }
+
+  return total;
+}
+
 /* Margins for free space in the log buffer after a log entry is catenated */
 #define LOG_BUF_FLUSH_RATIO	2
 #define LOG_BUF_FLUSH_MARGIN	((4 * 4096) /* cf. log_t::append_prepare() */ \
@@ -86,6 +470,25 @@ void log_t::set_capacity() noexcept
 	log_sys.max_checkpoint_age = margin;
 }
 
+thread_local unsigned log_t::sharded_latch::tls_stripe;
+thread_local unsigned char log_t::sharded_latch::tls_state;
+
+void log_t::sharded_latch::wait_for_readers() noexcept
+{
+  const auto rounds= srv_n_spin_wait_rounds;
+  for (const stripe &s : stripes)
+    for (auto r= rounds; s.readers.load(); )
+    {
+      if (r)
+      {
+        r--;
+        MY_RELAX_CPU();
+      }
+      else
+        std::this_thread::yield();
+    }
+}
+
 void log_t::create() noexcept
 {
   ut_ad(this == &log_sys);
@@ -107,6 +510,7 @@ void log_t::create() noexcept
 #ifdef HAVE_PMEM
   resize_wrap_mutex.init();
 #endif
+  log_archive.create();
 
   last_checkpoint_lsn= FIRST_LSN;
   log_capacity= 0;
@@ -329,7 +733,8 @@ bool log_t::attach(log_file_t file, os_offset_t size) noexcept
   ut_ad(!buf);
   ut_ad(!flush_buf);
   ut_ad(!writer);
-  if (size)
+  /* innodb_log_archive_dir is written to in log_write_buf() */
+  if (size && !srv_log_archive_dir)
   {
 # ifdef HAVE_PMEM
     bool is_pmem;
@@ -498,9 +903,12 @@ void log_t::close_file(bool really_close) noexcept
   writer= nullptr;
 
   if (really_close)
+  {
+    log_archive.close();
     if (is_opened())
       if (const dberr_t err= log.close())
         log_close_failed(err);
+  }
 }
 
 /** @return the current log sequence number (may be stale) */
@@ -760,8 +1168,11 @@ void log_t::resize_abort(void *thd) noexcept
 /** Write an aligned buffer to ib_logfile0.
 @param buf    buffer to be written
 @param length length of data to be written
-@param offset log file offset */
-static void log_write_buf(const byte *buf, size_t length, lsn_t offset)
+@param offset log file offset
+@param lsn    log sequence number at offset
+@param end    log sequence number at the end of the log records */
+static void log_write_buf(const byte *buf, size_t length, lsn_t offset,
+                          lsn_t lsn, lsn_t end)
 {
   ut_ad(write_lock.is_owner());
   ut_ad(!recv_no_log_write);
@@ -777,12 +1188,18 @@ static void log_write_buf(const byte *buf, size_t length, lsn_t offset)
   if (UNIV_UNLIKELY(length > maximum_write_length))
   {
     log_sys.log.write(offset, {buf, size_t(maximum_write_length)});
+    if (UNIV_LIKELY_NULL(srv_log_archive_dir))
+      log_archive.write(buf, size_t(maximum_write_length), offset, lsn,
+                        lsn + maximum_write_length);
     length-= size_t(maximum_write_length);
     buf+= size_t(maximum_write_length);
+    lsn+= maximum_write_length;
     ut_ad(log_sys.START_OFFSET + length < offset);
     offset= log_sys.START_OFFSET;
   }
   log_sys.log.write(offset, {buf, length});
+  if (UNIV_LIKELY_NULL(srv_log_archive_dir))
+    log_archive.write(buf, length, offset, lsn, end);
 }
 
 /** Invoke commit_checkpoint_notify_ha() to notify that outstanding
@@ -1100,7 +1517,9 @@ lsn_t log_t::write_buf() noexcept
                           write_lsn, lsn, offset));
 
     /* Do the write to the log file */
-    log_write_buf(write_buf, length, offset);
+    log_write_buf(write_buf, length, offset,
+                  write_lsn - (calc_lsn_offset(write_lsn) & write_size_1),
+                  lsn);
 
     if (UNIV_LIKELY_NULL(re_write_buf))
       resize_write_buf(re_write_buf, length);
@@ -1576,6 +1995,7 @@ void log_t::close()
 #ifdef HAVE_PMEM
   resize_wrap_mutex.destroy();
 #endif
+  log_archive.destroy();
 
   recv_sys.close();
 }
@@ -55,6 +55,7 @@ Created 9/20/1997 Heikki Tuuri
 #include "srv0start.h"
 #include "fil0pagecompress.h"
 #include "log.h"
+#include <zlib.h>
 
 /** The recovery system */
 recv_sys_t	recv_sys;
@@ -384,8 +385,35 @@ struct log_phys_t : public log_rec_t
         switch (const byte subtype= *l) {
           uint8_t ll;
           size_t prev_rec, hdr_size;
+          uLongf ulen;
         default:
           goto record_corrupted;
+        case WRITE_COMPRESSED:
+          if (UNIV_UNLIKELY(rlen < 4))
+            goto record_corrupted;
+          rlen--;
+          ll= mlog_decode_varint_length(*++l);
+          if (UNIV_UNLIKELY(ll > 3 || ll >= rlen))
+            goto record_corrupted;
+          prev_rec= mlog_decode_varint(l);
+          ut_ad(prev_rec != MLOG_DECODE_ERROR);
+          rlen-= ll;
+          l+= ll;
+          ll= mlog_decode_varint_length(*l);
+          if (UNIV_UNLIKELY(ll > 3 || ll >= rlen))
+            goto record_corrupted;
+          hdr_size= mlog_decode_varint(l);
+          ut_ad(hdr_size != MLOG_DECODE_ERROR);
+          rlen-= ll;
+          l+= ll;
+          if (UNIV_UNLIKELY(prev_rec < 8 || hdr_size > size ||
+                            prev_rec + hdr_size > size))
+            goto record_corrupted;
+          ulen= uLongf(hdr_size);
+          if (uncompress(frame + prev_rec, &ulen, l, uLong(rlen)) != Z_OK ||
+              ulen != hdr_size)
+            goto record_corrupted;
+          break;
         case INIT_ROW_FORMAT_REDUNDANT:
         case INIT_ROW_FORMAT_DYNAMIC:
           if (UNIV_UNLIKELY(rlen != 1))
@@ -1382,6 +1410,210 @@ void recv_sys_t::close_files()
   files.shrink_to_fit();
 }
 
+/** Pages that were listed by buf_flush_write_dirty_pages() after the
+checkpoint that recovery starts from. They are read into buffer pool
+blocks while the log is being parsed. The blocks are not added to
+buf_pool.page_hash, because a page that is in the buffer pool is
+assumed to be recovered. buf_read_recover() attaches a block by
+invoking recv_prefetched() instead of reading the page again. */
+static class recv_prefetch_t
+{
+  /** number of concurrent reader tasks */
+  static constexpr unsigned N_TASKS= 4;
+  /** the pages to read, and indexes to files */
+  std::vector<std::pair<page_id_t, uint32_t>> to_read;
+  /** the tablespace files that contain the pages */
+  std::vector<pfs_os_file_t> files;
+  /** the next element of to_read */
+  std::atomic<size_t> next{0};
+  /** protects pages, n_read, n_used */
+  std::mutex mutex;
+  /** the pages that have been read */
+  std::map<page_id_t, buf_block_t*> pages;
+  /** number of pages that have been read */
+  size_t n_read= 0;
+  /** number of pages that were attached by recv_prefetched() */
+  size_t n_used= 0;
+  tpool::task_group group{N_TASKS};
+  tpool::waitable_task task{[](void *p)
+                            { static_cast<recv_prefetch_t*>(p)->run(); },
+                            this, &group};
+
+  /** Read pages until to_read is exhausted or we run out of blocks */
+  void run() noexcept
+  {
+    for (size_t i; (i= next.fetch_add(1)) < to_read.size(); )
+    {
+      buf_block_t *block= nullptr;
+      mysql_mutex_lock(&buf_pool.mutex);
+      /* Leave enough blocks for recv_sys_t::add_block(). */
+      if (UT_LIST_GET_LEN(buf_pool.free) > 2 * BUF_LRU_MIN_LEN)
+        block= buf_LRU_get_free_block(have_mutex);
+      mysql_mutex_unlock(&buf_pool.mutex);
+      if (!block)
+        break;
+      const page_id_t id{to_read[i].first};
+      if (os_file_read(IORequestRead, files[to_read[i].second],
+                       block->page.frame,
+                       os_offset_t{id.page_no()} << srv_page_size_shift,
+                       srv_page_size, nullptr) != DB_SUCCESS)
+        buf_block_free(block);
+      else
+      {
+        std::lock_guard<std::mutex> g{mutex};
+        if (pages.emplace(id, block).second)
+          n_read++;
+        else
+          buf_block_free(block);
+      }
+    }
+  }
+
+public:
+  /** Start reading the pages.
+  @param checkpoint_lsn  the checkpoint that recovery starts from */
+  void start(lsn_t checkpoint_lsn) noexcept
+  {
+    ut_ad(files.empty());
+    ut_ad(pages.empty());
+    const std::string path{get_log_file_path(LOG_DIRTY_PAGES_FILE_NAME)};
+    FILE *f= fopen(path.c_str(), "r" STR_O_CLOEXEC);
+    if (!f)
+      return;
+
+    /* Use at most 1/8 of the buffer pool. */
+    const size_t max_pages= buf_pool.curr_size() / 8;
+    char line[OS_FILE_MAX_PATH + 32];
+    if (fgets(line, sizeof line, f) &&
+        strtoull(line, nullptr, 10) == checkpoint_lsn)
+    {
+      bool skip= true;
+      uint32_t file_space= 0;
+      while (to_read.size() < max_pages && fgets(line, sizeof line, f))
+      {
+        uint32_t space_id, page_no;
+        if (*line == '@')
+        {
+          unsigned page_size;
+          int pos= 0;
+          if (sscanf(line, "@%u,%u,%n", &space_id, &page_size, &pos) != 2 ||
+              !pos)
+            break;
+          char *name= line + pos;
+          name[strcspn(name, "\n")]= '\0';
+          skip= page_size != srv_page_size;
+          if (skip)
+            continue;
+          bool success;
+          pfs_os_file_t file= os_file_create_simple_no_error_handling(
+            innodb_data_file_key, name, OS_FILE_OPEN, OS_FILE_READ_ONLY,
+            true, &success);
+          skip= !success;
+          if (success)
+            files.emplace_back(file);
+          file_space= space_id;
+        }
+        else if (!skip && sscanf(line, "%u,%u", &space_id, &page_no) == 2 &&
+                 space_id == file_space)
+          to_read.emplace_back(page_id_t{space_id, page_no},
+                               uint32_t(files.size() - 1));
+      }
+    }
+
+    fclose(f);
+    if (to_read.empty())
+    {
+      close_files();
+      return;
+    }
+
+    sql_print_information("InnoDB: Reading %zu pages listed in %s",
+                          to_read.size(), path.c_str());
+    n_read= n_used= 0;
+    for (unsigned i= N_TASKS; i--; )
+      srv_thread_pool->submit_task(&task);
+  }
+
+  /** Wait for the reads to complete. */
+  void wait() noexcept
+  {
+    if (files.empty())
+      return;
+    task.wait();
+    close_files();
+  }
+
+  /** Remove a page that was read.
+  @param space  tablespace
+  @param id     page identifier
+  @return the block with the contents of the page
+  @retval nullptr if the page was not read or the copy is not usable */
+  buf_block_t *take(const fil_space_t &space, const page_id_t id) noexcept
+  {
+    ut_ad(files.empty());
+    buf_block_t *block;
+    {
+      std::lock_guard<std::mutex> g{mutex};
+      if (pages.empty())
+        return nullptr;
+      auto i= pages.find(id);
+      if (i == pages.end())
+        return nullptr;
+      block= i->second;
+      pages.erase(i);
+    }
+
+    const byte *frame= block->page.frame;
+    /* We read the page before buf_dblwr.recover(), which may have
+    restored a torn page. We do not attempt to decrypt or decompress
+    the page here. */
+    if (!space.zip_size() && !space.crypt_data && !space.is_compressed() &&
+        mach_read_from_4(frame + FIL_PAGE_SPACE_ID) == id.space() &&
+        mach_read_from_4(frame + FIL_PAGE_OFFSET) == id.page_no() &&
+        !buf_page_is_corrupted(false, frame, space.flags))
+    {
+      std::lock_guard<std::mutex> g{mutex};
+      n_used++;
+      return block;
+    }
+
+    buf_block_free(block);
+    return nullptr;
+  }
+
+  /** Free the pages that were not used. */
+  void free() noexcept
+  {
+    wait();
+    std::lock_guard<std::mutex> g{mutex};
+    if (!n_read)
+      return;
+    for (const auto &p : pages)
+      buf_block_free(p.second);
+    pages.clear();
+    sql_print_information("InnoDB: %zu of %zu pages listed in %s"
+                          " were used for recovery", n_used, n_read,
+                          LOG_DIRTY_PAGES_FILE_NAME);
+    n_read= 0;
+  }
+
+private:
+  void close_files() noexcept
+  {
+    for (pfs_os_file_t &file : files)
+      os_file_close(file);
+    files.clear();
+    to_read.clear();
+    next= 0;
+  }
+} recv_prefetch;
+
+buf_block_t *recv_prefetched(const fil_space_t &space, const page_id_t id)
+  noexcept
+{
+  return recv_prefetch.take(space, id);
+}
+
 /** Clean up after recv_sys_t::create() */
 void recv_sys_t::close()
 {
@@ -1399,6 +1631,8 @@ void recv_sys_t::close()
     mysql_mutex_destroy(&mutex);
   }
 
+  recv_prefetch.free();
+
   recv_spaces.clear();
   renamed_spaces.clear();
   mlog_init.clear();
@@ -1477,6 +1711,7 @@ void recv_sys_t::debug_free()
   tmp_free();
 
   mysql_mutex_unlock(&mutex);
+  recv_prefetch.free();
   log_sys.clear_mmap();
 }
 
@@ -4013,6 +4248,14 @@ static void log_sort_flush_list() noexcept
   mysql_mutex_unlock(&buf_pool.flush_list_mutex);
 }
 
+/** @return the maximum number of concurrent recv_recover_page() calls */
+static uint recv_apply_concurrency() noexcept
+{
+  if (srv_n_recovery_threads)
+    return srv_n_recovery_threads;
+  return std::max(uint(my_getncpus()), srv_n_read_io_threads);
+}
+
 /** Apply buffered log to persistent data pages.
 @param last_batch     whether it is possible to write more redo log */
 void recv_sys_t::apply(bool last_batch)
@@ -4023,6 +4266,7 @@ void recv_sys_t::apply(bool last_batch)
 
   mysql_mutex_assert_owner(&mutex);
 
+  recv_prefetch.wait();
   garbage_collect();
 
   if (truncated_sys_space.lsn)
@@ -4083,6 +4327,12 @@ void recv_sys_t::apply(bool last_batch)
 
     fil_system.extend_to_recv_size();
 
+    /* Pages are recovered in buf_page_t::read_complete() or
+    IORequest::fake_read_complete(), which are executed in the read
+    completion callbacks. Allow more of them to run concurrently
+    than innodb_read_io_threads, because applying log is CPU bound. */
+    os_aio_set_read_concurrency(recv_apply_concurrency());
+
     fil_space_t *space= nullptr;
     uint32_t space_id= ~0;
     buf_block_t *free_block= nullptr;
@@ -4115,6 +4365,7 @@ void recv_sys_t::apply(bool last_batch)
         {
           if (space)
             space->release();
+          os_aio_set_read_concurrency(srv_n_read_io_threads);
           if (free_block)
           {
             mysql_mutex_unlock(&mutex);
@@ -4133,6 +4384,8 @@ void recv_sys_t::apply(bool last_batch)
     if (space)
       space->release();
 
+    os_aio_set_read_concurrency(srv_n_read_io_threads);
+
     if (free_block)
     {
       mysql_mutex_lock(&buf_pool.mutex);
@@ -4141,6 +4394,11 @@ void recv_sys_t::apply(bool last_batch)
     }
   }
 
+  /* Release the blocks that were not attached by this batch. A page that
+  was not attached was written before the checkpoint or it is needed by a
+  later batch, which will read it again. */
+  recv_prefetch.free();
+
   if (last_batch)
   {
     mlog_init.clear();
@@ -4792,6 +5050,10 @@ dberr_t recv_recovery_from_checkpoint_start()
 		const bool rewind = recv_sys.lsn
 			!= log_sys.next_checkpoint_lsn;
 		log_sys.last_checkpoint_lsn = log_sys.next_checkpoint_lsn;
+		if (srv_operation <= SRV_OPERATION_EXPORT_RESTORED) {
+			recv_prefetch.start(
+				log_sys.next_checkpoint_lsn);
+		}
 		parser[false] = get_parse_mmap<recv_sys_t::store::NO>();
 		parser[true] = get_parse_mmap<recv_sys_t::store::YES>();
 		recv_scan_log(false, parser);
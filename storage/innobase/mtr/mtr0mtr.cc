@@ -37,6 +37,7 @@ Created 11/26/1995 Heikki Tuuri
 #include "trx0trx.h"
 #include "log.h"
 #include "my_cpu.h"
+#include <zlib.h>
 
 #ifdef HAVE_PMEM
 void (*mtr_t::commit_logger)(mtr_t *, std::pair<lsn_t,lsn_t>);
@@ -1062,6 +1063,107 @@ inline void mtr_t::page_checksum(const buf_page_t &bpage)
   m_log.close(l + 4);
 }
 
+void mtr_t::log_page_images() noexcept
+{
+  ut_ad(m_log_mode == MTR_LOG_ALL);
+
+  /** a page whose records will be replaced with a page image */
+  struct image_t
+  {
+    /** the page */
+    buf_block_t *block;
+    /** length of id */
+    uint32_t len;
+    /** the encoded tablespace identifier and page number */
+    byte id[5 + 5];
+  };
+
+  small_vector<image_t, 16> images;
+
+  for (const mtr_memo_slot_t &slot : m_memo)
+  {
+    if (!(slot.type & MTR_MEMO_MODIFY))
+      continue;
+    buf_block_t *b= static_cast<buf_block_t*>(slot.object);
+    const uint32_t s= b->page.state();
+    /* Skip pages that are already in buf_pool.flush_list, pages that
+    will be recovered from an INIT_PAGE record, and ROW_FORMAT=COMPRESSED
+    pages, which will continue to use the doublewrite buffer. */
+    if (b->page.oldest_modification() > 1 ||
+        buf_page_t::is_freed(s) || b->page.is_reinit() ||
+        b->page.zip.data || b->page.id().space() >= SRV_TMP_SPACE_ID)
+      continue;
+    const page_id_t id{b->page.id()};
+    image_t i;
+    i.block= b;
+    i.len= uint32_t(mlog_encode_varint(mlog_encode_varint(i.id, id.space()),
+                                       id.page_no()) - i.id);
+    images.emplace_back(i);
+  }
+
+  if (images.empty())
+    return;
+
+  /* Recovery must not apply the records that were written for these
+  pages before our INIT_PAGE record, because the page image already
+  reflects them. Discard those records. A same_page record can only
+  follow a record for the same page, so the remaining records will be
+  parsed in the same way as before. */
+  size_t size= 0;
+  for (const mtr_buf_t::block_t &b : m_log)
+    size+= b.used();
+  byte *const buf= static_cast<byte*>(ut_malloc_nokey(size));
+  byte *const end= buf + size;
+  size= 0;
+  for (const mtr_buf_t::block_t &b : m_log)
+  {
+    ::memcpy(buf + size, b.begin(), b.used());
+    size+= b.used();
+  }
+  m_log.erase();
+
+  bool got_page_op= false, skip= false;
+  for (const byte *l= buf; l < end; )
+  {
+    const byte *const rec= l;
+    const byte b= *l;
+    uint32_t rlen;
+    l= parse_length(l, &rlen);
+    if (!(b & 0x80) || !got_page_op)
+    {
+      /* A record with a tablespace identifier and page number */
+      got_page_op= !(b & 0x80);
+      skip= false;
+      if (got_page_op)
+        for (const image_t &i : images)
+          if (i.len <= rlen && !memcmp(l, i.id, i.len))
+          {
+            skip= true;
+            break;
+          }
+    }
+    l+= rlen;
+    if (!skip)
+      m_log.push(rec, uint32_t(l - rec));
+  }
+
+  ut_free(buf);
+  m_last= nullptr;
+
+  for (const image_t &i : images)
+  {
+    buf_block_t *b= i.block;
+    /* Recovery will not read the page from the data file. Hence, the
+    page can be written without the doublewrite buffer until the next
+    time it is made dirty. */
+    b->page.set_reinit(b->page.state() & buf_page_t::LRU_MASK);
+    m_log.close(log_write<INIT_PAGE>(b->page.id(), &b->page));
+    m_last_offset= FIL_PAGE_TYPE;
+    memcpy_low(*b, FIL_PAGE_OFFSET, b->page.frame + FIL_PAGE_OFFSET,
+               srv_page_size - FIL_PAGE_OFFSET - FIL_PAGE_DATA_END);
+  }
+}
+
 std::pair<lsn_t,lsn_t> mtr_t::do_write() noexcept
 {
   ut_ad(!recv_no_log_write);
@@ -1072,6 +1174,9 @@ std::pair<lsn_t,lsn_t> mtr_t::do_write() noexcept
         (m_user_space->id > 0 && m_user_space->id < SRV_SPACE_ID_UPPER_BOUND));
   m_commit_lsn= 0;
 
+  if (m_made_dirty && buf_dblwr.log_page_images())
+    log_page_images();
+
 #ifndef DBUG_OFF
   do
   {
@@ -1632,6 +1737,56 @@ void mtr_t::init(buf_block_t *b)
   m_last_offset= FIL_PAGE_TYPE;
 }
 
+bool mtr_t::memcpy_compressed(const buf_block_t &block, uint16_t offset,
+                              const void *data, size_t len)
+{
+  ut_ad(len >= LOG_COMPRESS_MIN_LEN);
+  ut_ad(offset >= 8);
+  ut_ad(offset + len <= block.physical_size());
+  ut_ad(!block.zip_size());
+
+  /* Insist on saving at least 1/8 of the space; otherwise
+  it would not be worth the effort to decompress on recovery. */
+  uLongf clen= uLongf(len - len / 8);
+  byte *buf= static_cast<byte*>(ut_malloc_nokey(clen));
+  if (UNIV_UNLIKELY(!buf))
+    return false;
+  if (compress2(buf, &clen, static_cast<const Bytef*>(data), uLong(len),
+                Z_BEST_SPEED) != Z_OK)
+  {
+    ut_free(buf);
+    return false;
+  }
+
+  byte hdr[1 + 3 + 3];
+  byte *h= hdr;
+  *h++= WRITE_COMPRESSED;
+  h= mlog_encode_varint(h, offset);
+  h= mlog_encode_varint(h, len);
+  const uint32_t hdr_len= uint32_t(h - hdr);
+  const size_t rec_len= hdr_len + clen;
+
+  if (rec_len < mtr_buf_t::MAX_DATA_SIZE - (1 + 3 + 3 + 5 + 5))
+  {
+    byte *end= log_write<EXTENDED>(block.page.id(), &block.page, rec_len,
+                                   true);
+    ::memcpy(end, hdr, hdr_len);
+    ::memcpy(end + hdr_len, buf, clen);
+    m_log.close(end + rec_len);
+  }
+  else
+  {
+    m_log.close(log_write<EXTENDED>(block.page.id(), &block.page, rec_len,
+                                    false));
+    m_log.push(hdr, hdr_len);
+    m_log.push(buf, uint32_t(clen));
+  }
+
+  ut_free(buf);
+  m_last_offset= FIL_PAGE_TYPE;
+  return true;
+}
+
 /** Free a page.
 @param space   tablespace
 @param offset  offset of the page to be freed */
@@ -1249,6 +1249,8 @@ os_file_create_func(
 		*success = false;
 		close(file);
 		file = -1;
+	} else if (type == OS_DATA_FILE && srv_thread_pool) {
+		srv_thread_pool->bind(file);
 	}
 
 	return(file);
@@ -1408,6 +1410,8 @@ os_file_get_last_error.
 @return true if success */
 bool os_file_close_func(os_file_t file)
 {
+  if (srv_thread_pool)
+    srv_thread_pool->unbind(file);
   int ret= close(file);
 
   if (!ret)
@@ -3051,7 +3055,8 @@ static void read_io_callback(void *c)
 static void write_io_callback(void *c)
 {
   tpool::aiocb *cb= static_cast<tpool::aiocb*>(c);
-  ut_ad(cb->m_opcode == tpool::aio_opcode::AIO_PWRITE);
+  ut_ad(cb->m_opcode == tpool::aio_opcode::AIO_PWRITE ||
+        cb->m_opcode == tpool::aio_opcode::AIO_PWRITE_ATOMIC);
   ut_ad(write_slots->contains(cb));
   const IORequest &request= *static_cast<const IORequest*>
     (static_cast<const void*>(cb->m_userdata));
@@ -3084,6 +3089,9 @@ int os_aio_init() noexcept
     compile_time_assert(SRV_LINUX_AIO_LIBAIO == (srv_linux_aio_t) tpool::OS_IO_LIBAIO);
     compile_time_assert(SRV_LINUX_AIO_AUTO == (srv_linux_aio_t) tpool::OS_IO_DEFAULT);
     aio_impl=(tpool::aio_implementation) srv_linux_aio_method;
+    srv_thread_pool->set_uring_options
+      ((srv_io_uring_sqpoll ? tpool::URING_SQPOLL : 0) |
+       (srv_io_uring_fixed ? tpool::URING_FIXED : 0));
 #endif
 
     ret= srv_thread_pool->configure_aio(srv_use_native_aio, max_events,
@@ -3113,6 +3121,21 @@ int os_aio_init() noexcept
 }
 
 
+void os_aio_set_read_concurrency(uint n) noexcept
+{
+  read_slots->task_group().set_max_tasks(n);
+}
+
+/** Memory registered by os_aio_register_buffers() */
+static std::pair<void*,size_t> os_aio_buffers;
+
+void os_aio_register_buffers(void *buf, size_t size) noexcept
+{
+  os_aio_buffers= {buf, size};
+  if (srv_thread_pool)
+    srv_thread_pool->register_buffers(buf, size);
+}
+
 /**
 Change reader or writer thread parameter on a running server.
 This includes resizing  the io slots, as we calculate
@@ -3150,6 +3173,9 @@ int os_aio_resize(ulint n_reader_threads, ulint n_writer_threads) noexcept
   io context with changed max_events, etc.) */
 
   int ret= srv_thread_pool->reconfigure_aio(srv_use_native_aio, events);
+  if (!ret && os_aio_buffers.first)
+    srv_thread_pool->register_buffers(os_aio_buffers.first,
+                                      os_aio_buffers.second);
 
   if (ret)
   {
@@ -3320,7 +3346,12 @@ dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n)
 		++os_n_file_writes;
 		slots = write_slots;
 		callback = write_io_callback;
-		opcode = tpool::aio_opcode::AIO_PWRITE;
+		/* Single page writes to a file that relies on
+		RWF_ATOMIC instead of the doublewrite buffer */
+		opcode = type.bpage && type.node->rwf_atomic
+			&& n == type.node->space->physical_size()
+			? tpool::aio_opcode::AIO_PWRITE_ATOMIC
+			: tpool::aio_opcode::AIO_PWRITE;
 	}
 
 	compile_time_assert(sizeof(IORequest) <= tpool::MAX_AIO_USERDATA_LEN);
@@ -3615,6 +3646,18 @@ void fil_node_t::find_metadata(IF_WIN(,bool create)) noexcept
   atomic_write= srv_use_atomic_writes &&
     IF_WIN(srv_page_size == block_size,
            my_test_if_atomic_write(file, space->physical_size()));
+  rwf_atomic= false;
+#ifdef __linux__
+  /* Any file system or device that advertises atomic writes of the
+  page size for O_DIRECT (such as ext4 or XFS on suitable NVMe drives)
+  can avoid the doublewrite buffer, provided that each page write is
+  submitted with RWF_ATOMIC. With page_compressed, the writes would be
+  shorter than the page size. */
+  if (!atomic_write && srv_use_atomic_writes && !fil_system.is_buffered() &&
+      !space->is_compressed() &&
+      my_test_if_rwf_atomic(file, space->physical_size()))
+    atomic_write= rwf_atomic= true;
+#endif
 }
 
 /** Read the first page of a data file.
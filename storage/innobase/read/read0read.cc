@@ -203,6 +203,13 @@ inline void ReadViewBase::snapshot(trx_t *trx)
   Reuses closed view if there were no read-write transactions since (and at)
   its creation time.
 
+  Also reuses closed view of a non-locking autocommit transaction without
+  taking a new snapshot if no transaction has been registered, assigned a
+  serialisation number or deregistered since the view was created: then
+  rw_trx_hash would yield exactly the same snapshot. This is done under
+  m_mutex, so that trx_sys_t::clone_oldest_view() either sees the view
+  open or has taken its own snapshot before our check.
+
   Original comment states: there is an inherent race here between purge
   and this thread.
 
@@ -240,7 +247,14 @@ void ReadView::open(trx_t *trx)
     else
     {
       m_mutex.wr_lock();
-      snapshot(trx);
+      const uint64_t erases= trx_sys.get_rw_trx_hash_erases();
+      if (!trx->is_autocommit_non_locking() ||
+          erases != m_rw_trx_hash_erases ||
+          low_limit_id() != trx_sys.get_max_trx_id())
+      {
+        snapshot(trx);
+        m_rw_trx_hash_erases= erases;
+      }
       m_open.store(true, std::memory_order_relaxed);
       m_mutex.wr_unlock();
     }
@@ -3317,6 +3317,298 @@ row_merge_blocks_copy(
 		    != NULL);
 }
 
+/** Shared state of a row_merge_parallel() pass */
+struct row_merge_pll_t {
+	trx_t*			trx;	/*!< transaction */
+	row_merge_dup_t		dup;	/*!< descriptor of index being created,
+					without a TABLE for reporting */
+	const merge_file_t*	file;	/*!< input file */
+	pfs_os_file_t		fd;	/*!< output file handle */
+	const ulint*		in;	/*!< first offset of each input run */
+	ulint			n_run;	/*!< number of input runs */
+	ulint			half;	/*!< number of runs in the first
+					half of the input */
+	ulint			space;	/*!< tablespace ID for encryption */
+	std::atomic<ulint>	next;	/*!< next merge to perform */
+	std::atomic<ib_uint64_t>n_rec;	/*!< number of records written */
+	std::atomic<ulint>	end;	/*!< end offset of the output */
+	std::atomic<ulint>	failed;	/*!< smallest merge that found
+					a duplicate, or ULINT_UNDEFINED */
+	std::atomic<dberr_t>	err;	/*!< first error */
+
+	/** @return number of merges in the pass */
+	ulint n_merges() const { return n_run - half; }
+
+	/** @return first output offset of a merge
+	@param[in]	k	merge number */
+	ulint out_offset(ulint k) const
+	{
+		/* The output of a merge is never longer than its input,
+		so placing each output at the sum of the preceding input
+		lengths keeps the outputs disjoint. */
+		return in[k] + in[half + k] - in[half];
+	}
+};
+
+/** Perform one merge of a row_merge_parallel() pass.
+Merge number k < half merges the runs k and half + k; the last merge
+copies the extra run of the second half, if the number of runs is odd.
+@param[in,out]	pll		pass state
+@param[in]	k		merge number
+@param[in]	dup		descriptor of index being created
+@param[in,out]	block		3 buffers
+@param[in,out]	crypt_block	encryption buffer
+@param[in,out]	stage		performance schema accounting object,
+or NULL
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_pll_run(
+	row_merge_pll_t*	pll,
+	ulint			k,
+	const row_merge_dup_t*	dup,
+	row_merge_block_t*	block,
+	row_merge_block_t*	crypt_block,
+	ut_stage_alter_t*	stage)
+{
+	merge_file_t	of;
+	ulint		foffs1 = pll->in[pll->half + k];
+	dberr_t		error = DB_SUCCESS;
+
+	of.fd = pll->fd;
+	of.offset = pll->out_offset(k);
+	of.n_rec = 0;
+
+	if (k < pll->half) {
+		ulint	foffs0 = pll->in[k];
+
+		error = row_merge_blocks(dup, pll->file, block,
+					 &foffs0, &foffs1, &of, stage,
+					 crypt_block, pll->space);
+	} else if (!row_merge_blocks_copy(dup->index, pll->file, block,
+					  &foffs1, &of, stage,
+					  crypt_block, pll->space)) {
+		error = DB_CORRUPTION;
+	}
+
+	if (error == DB_SUCCESS) {
+		pll->n_rec += of.n_rec;
+
+		ulint	end = pll->end;
+		while (end < of.offset
+		       && !pll->end.compare_exchange_weak(end, of.offset)) {
+		}
+	}
+
+	return(error);
+}
+
+/** Perform merges of a row_merge_parallel() pass until none are left.
+@param[in,out]	pll		pass state
+@param[in,out]	block		3 buffers
+@param[in,out]	crypt_block	encryption buffer
+@param[in,out]	stage		performance schema accounting object,
+or NULL */
+static
+void
+row_merge_pll_worker(
+	row_merge_pll_t*	pll,
+	row_merge_block_t*	block,
+	row_merge_block_t*	crypt_block,
+	ut_stage_alter_t*	stage)
+{
+	while (pll->err == DB_SUCCESS) {
+		const ulint	k = pll->next++;
+
+		if (k >= pll->n_merges()) {
+			break;
+		}
+
+		dberr_t	error = trx_is_interrupted(pll->trx)
+			? DB_INTERRUPTED
+			: row_merge_pll_run(pll, k, &pll->dup, block,
+					    crypt_block, stage);
+
+		if (error == DB_DUPLICATE_KEY) {
+			ulint	failed = pll->failed;
+			while (k < failed
+			       && !pll->failed.compare_exchange_weak(
+				       failed, k)) {
+			}
+		}
+
+		if (error != DB_SUCCESS) {
+			dberr_t	e = DB_SUCCESS;
+			pll->err.compare_exchange_strong(e, error);
+		}
+	}
+}
+
+/** A helper thread of row_merge_parallel() */
+struct row_merge_pll_helper_t {
+	row_merge_pll_t*	pll;		/*!< pass state */
+	row_merge_block_t*	block;		/*!< 3 buffers */
+	ut_new_pfx_t		block_pfx;	/*!< for deallocating block */
+	row_merge_block_t*	crypt_block;	/*!< encryption buffer */
+	ut_new_pfx_t		crypt_pfx;	/*!< for deallocating
+						crypt_block */
+	tpool::waitable_task*	task;		/*!< the task */
+};
+
+/** srv_thread_pool task of a row_merge_parallel() helper.
+@param[in,out]	arg	row_merge_pll_helper_t */
+static
+void
+row_merge_pll_task(void* arg)
+{
+	row_merge_pll_helper_t*	h = static_cast<row_merge_pll_helper_t*>(arg);
+	row_merge_pll_worker(h->pll, h->block, h->crypt_block, NULL);
+}
+
+/** Merge disk files by multiple threads. This performs the same pass
+as row_merge(), but the merges of the run pairs are independent of each
+other and are distributed among srv_thread_pool tasks and the calling
+thread. Each merge writes its output to a disjoint range of the output
+file, so that unlike in row_merge(), there may be gaps between the
+output runs.
+@param[in]	trx		transaction
+@param[in]	dup		descriptor of index being created
+@param[in,out]	file		file containing index entries
+@param[in,out]	block		3 buffers
+@param[in,out]	tmpfd		temporary file handle
+@param[in,out]	num_run		Number of runs that remain to be merged
+@param[in,out]	run_offset	Array that contains the first offset number
+for each merge run
+@param[in,out]	stage		performance schema accounting object, used by
+ALTER TABLE. If not NULL stage->inc() will be called for each record
+processed by the calling thread.
+@param[in,out]	crypt_block	encryption buffer
+@param[in]	space		tablespace ID for encryption
+@param[in]	n_threads	maximum number of threads
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_parallel(
+	trx_t*			trx,
+	const row_merge_dup_t*	dup,
+	merge_file_t*		file,
+	row_merge_block_t*	block,
+	pfs_os_file_t*		tmpfd,
+	ulint*			num_run,
+	ulint*			run_offset,
+	ut_stage_alter_t*	stage,
+	row_merge_block_t*	crypt_block,
+	ulint			space,
+	ulint			n_threads)
+{
+	row_merge_pll_t	pll;
+	ulint*		in = static_cast<ulint*>(
+		ut_malloc_nokey(*num_run * sizeof *in));
+
+	if (in == NULL) {
+		return(DB_OUT_OF_MEMORY);
+	}
+
+	memcpy(in, run_offset, *num_run * sizeof *in);
+
+	pll.trx = trx;
+	pll.dup = *dup;
+	pll.dup.table = NULL;
+	pll.file = file;
+	pll.fd = *tmpfd;
+	pll.in = in;
+	pll.n_run = *num_run;
+	pll.half = *num_run / 2;
+	pll.space = space;
+	pll.next = 0;
+	pll.n_rec = 0;
+	pll.end = 0;
+	pll.failed = ULINT_UNDEFINED;
+	pll.err = DB_SUCCESS;
+
+	ut_ad(in[pll.half] < file->offset);
+
+	const ulint	n_helpers = std::min(n_threads, pll.n_merges()) - 1;
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	row_merge_pll_helper_t*	helpers = n_helpers
+		? static_cast<row_merge_pll_helper_t*>(
+			ut_zalloc_nokey(n_helpers * sizeof *helpers))
+		: NULL;
+	ulint	n_started = 0;
+
+	for (; helpers && n_started < n_helpers; n_started++) {
+		row_merge_pll_helper_t&	h = helpers[n_started];
+
+		h.pll = &pll;
+		h.block = alloc.allocate_large(3 * srv_sort_buf_size,
+					       &h.block_pfx);
+		if (h.block == NULL) {
+			break;
+		}
+
+		if (crypt_block) {
+			h.crypt_block = alloc.allocate_large(
+				3 * srv_sort_buf_size, &h.crypt_pfx);
+			if (h.crypt_block == NULL) {
+				alloc.deallocate_large(h.block, &h.block_pfx);
+				break;
+			}
+		}
+
+		h.task = new tpool::waitable_task(row_merge_pll_task, &h);
+		srv_thread_pool->submit_task(h.task);
+	}
+
+	row_merge_pll_worker(&pll, block, crypt_block, stage);
+
+	for (ulint i = 0; i < n_started; i++) {
+		row_merge_pll_helper_t&	h = helpers[i];
+
+		h.task->wait();
+		delete h.task;
+		alloc.deallocate_large(h.block, &h.block_pfx);
+		if (h.crypt_block) {
+			alloc.deallocate_large(h.crypt_block, &h.crypt_pfx);
+		}
+	}
+
+	ut_free(helpers);
+
+	dberr_t	error = pll.err;
+
+	if (error == DB_DUPLICATE_KEY && dup->table) {
+		/* Redo the merge with the TABLE, in order to report
+		the duplicate key value. */
+		error = row_merge_pll_run(&pll, pll.failed, dup, block,
+					  crypt_block, NULL);
+		ut_ad(error == DB_DUPLICATE_KEY);
+	} else if (error == DB_SUCCESS && pll.n_rec != file->n_rec) {
+		error = DB_CORRUPTION;
+	}
+
+	if (error == DB_SUCCESS) {
+		const ulint	n_merges = pll.n_merges();
+
+		for (ulint k = 0; k < n_merges; k++) {
+			run_offset[k] = pll.out_offset(k);
+		}
+
+		ut_ad(pll.end <= file->offset);
+
+		*num_run = n_merges;
+
+		/* Swap file descriptors for the next pass. */
+		*tmpfd = file->fd;
+		file->fd = pll.fd;
+		file->offset = pll.end;
+	}
+
+	ut_free(in);
+	MEM_UNDEFINED(&block[0], 3 * srv_sort_buf_size);
+
+	return(error);
+}
+
 /** Merge disk files.
 @param[in]	trx		transaction
 @param[in]	dup		descriptor of index being created
@@ -3474,6 +3766,7 @@ row_merge(
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL, stage->begin_phase_sort() will be called initially
 and then stage->inc() will be called for each record processed.
+@param[in]	n_threads	maximum number of threads for merging runs
 @return DB_SUCCESS or error code */
 dberr_t
 row_merge_sort(
@@ -3491,7 +3784,8 @@ row_merge_sort(
 	const double		pct_cost, /*!< in: current progress percent */
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space,	   /*!< in: space id */
-	ut_stage_alter_t* 	stage)
+	ut_stage_alter_t* 	stage,
+	ulint			n_threads)
 {
 	const ulint	half	= file->offset / 2;
 	ulint		num_runs;
@@ -3521,8 +3815,14 @@ row_merge_sort(
 	run_offset = (ulint*) ut_malloc_nokey(file->offset * sizeof(ulint));
 
 	/* This tells row_merge() where to start for the first round
-	of merge. */
-	run_offset[half] = half;
+	of merge. row_merge_parallel() needs the start of each run. */
+	if (n_threads > 1) {
+		for (ulint i = 0; i < num_runs; i++) {
+			run_offset[i] = i;
+		}
+	} else {
+		run_offset[half] = half;
+	}
 
 	/* The file should always contain at least one byte (the end
 	of file marker).  Thus, it must be at least one block. */
@@ -3536,9 +3836,20 @@ row_merge_sort(
 
 	/* Merge the runs until we have one big run */
 	do {
-		error = row_merge(trx, dup, file, block, tmpfd,
-				  &num_runs, run_offset, stage,
-				  crypt_block, space);
+		/* row_merge() requires the runs to be contiguous, which
+		row_merge_parallel() does not guarantee. Hence, all passes
+		must be performed by the same function. */
+		if (n_threads > 1) {
+			error = row_merge_parallel(trx, dup, file, block,
+						   tmpfd, &num_runs,
+						   run_offset, stage,
+						   crypt_block, space,
+						   n_threads);
+		} else {
+			error = row_merge(trx, dup, file, block, tmpfd,
+					  &num_runs, run_offset, stage,
+					  crypt_block, space);
+		}
 
 		if(update_progress) {
 			merge_count++;
@@ -4858,7 +5169,7 @@ row_merge_build_indexes(
 					block, &tmpfd, true,
 					pct_progress, pct_cost,
 					crypt_block, new_table->space_id,
-					stage);
+					stage, srv_merge_sort_threads);
 
 			pct_progress += pct_cost;
 
@@ -67,11 +67,14 @@ Created 9/17/2000 Heikki Tuuri
 #include <thread>
 
 
-/** Delay an INSERT, DELETE or UPDATE operation if the purge is lagging. */
-static void row_mysql_delay_if_needed() noexcept
+/** Delay an INSERT, DELETE or UPDATE operation if the purge is lagging.
+@param table  the table that is being modified */
+static void row_mysql_delay_if_needed(const dict_table_t &table) noexcept
 {
-  const auto delay= srv_dml_needed_delay;
-  if (UNIV_UNLIKELY(delay != 0))
+  auto delay= srv_dml_needed_delay;
+  if (UNIV_UNLIKELY(delay != 0) &&
+      (!srv_max_purge_lag_per_table ||
+       (delay= trx_purge_dml_delay(table.id, delay))))
   {
     /* Adjust for purge_coordinator_state::refresh() */
     log_sys.latch.rd_lock(SRW_LOCK_CALL);
@@ -960,26 +963,7 @@ void row_prebuilt_free(row_prebuilt_t *prebuilt)
 		mem_heap_free(prebuilt->old_vers_heap);
 	}
 
-	if (prebuilt->fetch_cache[0] != NULL) {
-		byte*	base = prebuilt->fetch_cache[0] - 4;
-		byte*	ptr = base;
-
-		for (ulint i = 0; i < MYSQL_FETCH_CACHE_SIZE; i++) {
-			ulint	magic1 = mach_read_from_4(ptr);
-			ut_a(magic1 == ROW_PREBUILT_FETCH_MAGIC_N);
-			ptr += 4;
-
-			byte*	row = ptr;
-			ut_a(row == prebuilt->fetch_cache[i]);
-			ptr += prebuilt->mysql_row_len;
-
-			ulint	magic2 = mach_read_from_4(ptr);
-			ut_a(magic2 == ROW_PREBUILT_FETCH_MAGIC_N);
-			ptr += 4;
-		}
-
-		ut_free(base);
-	}
+	row_sel_prefetch_cache_free(prebuilt);
 
 	if (prebuilt->rtr_info) {
 		rtr_clean_rtr_info(prebuilt->rtr_info, true);
@@ -1260,7 +1244,7 @@ row_insert_for_mysql(
 
 	trx->op_info = "inserting";
 
-	row_mysql_delay_if_needed();
+	row_mysql_delay_if_needed(*table);
 
 	if (!table->no_rollback()) {
 		trx_start_if_not_started_xa(trx, true);
@@ -1617,7 +1601,7 @@ row_update_for_mysql(row_prebuilt_t* prebuilt)
 
 	trx->op_info = "updating or deleting";
 
-	row_mysql_delay_if_needed();
+	row_mysql_delay_if_needed(*table);
 
 	init_fts_doc_id_for_ref(table, &fk_depth);
 
@@ -0,0 +1,359 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file row/row0pread.cc
+Parallel consistent read of a clustered index
+*******************************************************/
+
+#include "row0pread.h"
+#include "btr0pcur.h"
+#include "dict0dict.h"
+#include "rem0cmp.h"
+#include "row0row.h"
+#include "row0vers.h"
+#include "srv0srv.h"
+#include "trx0trx.h"
+#include <vector>
+
+/** State of row_parallel_scan() */
+struct row_pread_ctx
+{
+  /** the clustered index */
+  dict_index_t *const index;
+  /** the transaction whose read view is being used */
+  trx_t *const trx;
+  /** the callback for each visible record */
+  const row_pread_callback_t callback;
+  /** the argument of callback */
+  void *const arg;
+  /** boundaries of the ranges; the first one is nullptr (the minimum)
+  and the last range extends to the end of the index */
+  std::vector<const dtuple_t*> bounds;
+  /** the next range to scan */
+  std::atomic<size_t> next{0};
+  /** the first error that was encountered */
+  std::atomic<dberr_t> err{DB_SUCCESS};
+
+  row_pread_ctx(dict_index_t *index, trx_t *trx,
+                row_pread_callback_t callback, void *arg) :
+    index(index), trx(trx), callback(callback), arg(arg) {}
+
+  /** @return whether the scan has been aborted */
+  bool aborted() const
+  { return err.load(std::memory_order_relaxed) != DB_SUCCESS; }
+  /** Abort the scan.
+  @param error  the reason of aborting */
+  void abort(dberr_t error)
+  {
+    dberr_t e= DB_SUCCESS;
+    err.compare_exchange_strong(e, error);
+  }
+};
+
+/** Partition a clustered index into ranges by the node pointer records
+of the upper levels of the tree. Any ascending sequence of keys will
+partition the index correctly, even if the tree is modified after we
+release the latches. We hold the index S-latch while reading the node
+pointer pages, so that the pages cannot be split, merged or freed.
+@param ctx     scan context
+@param target  number of ranges that suffices
+@param heap    memory heap for the keys
+@return error code */
+static dberr_t row_pread_partition(row_pread_ctx &ctx, size_t target,
+                                   mem_heap_t *heap)
+{
+  struct node
+  {
+    /** child page number */
+    uint32_t page_no;
+    /** smallest key in the subtree, or nullptr for the minimum */
+    const dtuple_t *start;
+  };
+
+  dict_index_t *index= ctx.index;
+  const ulint n_fields= dict_index_get_n_unique_in_tree(index);
+  dberr_t err;
+  mtr_t mtr{ctx.trx};
+  mtr.start();
+  mtr_s_lock_index(index, &mtr);
+
+  const buf_block_t *block= btr_root_block_get(index, RW_S_LATCH, &mtr, &err);
+  if (!block)
+  {
+    mtr.commit();
+    return err;
+  }
+
+  std::vector<node> pages{{block->page.id().page_no(), nullptr}};
+  ulint level= btr_page_get_level(block->page.frame);
+  mtr.release_last_page();
+
+  rec_offs *offsets= nullptr;
+  mem_heap_t *offsets_heap= nullptr;
+
+  while (level && pages.size() < target)
+  {
+    std::vector<node> children;
+
+    for (const node &n : pages)
+    {
+      block= btr_block_get(*index, n.page_no, RW_S_LATCH, &mtr, &err);
+      if (!block)
+        goto func_exit;
+      if (btr_page_get_level(block->page.frame) != level)
+      {
+        err= DB_CORRUPTION;
+        goto func_exit;
+      }
+
+      page_cur_t cur;
+      page_cur_set_before_first(block, &cur);
+
+      for (bool first= true;; first= false)
+      {
+        if (!page_cur_move_to_next(&cur))
+        {
+          err= DB_CORRUPTION;
+          goto func_exit;
+        }
+        if (page_cur_is_after_last(&cur))
+          break;
+
+        const rec_t *rec= page_cur_get_rec(&cur);
+        offsets= rec_get_offsets(rec, index, offsets, 0, ULINT_UNDEFINED,
+                                 &offsets_heap);
+        const dtuple_t *start= n.start;
+        if (!first)
+        {
+          dtuple_t *tuple= dtuple_create(heap, uint16_t(n_fields));
+          dict_index_copy_types(tuple, index, n_fields);
+          rec_copy_prefix_to_dtuple(tuple, rec, index, 0, n_fields, heap);
+          start= tuple;
+        }
+        children.push_back({btr_node_ptr_get_child_page_no(rec, offsets),
+                            start});
+      }
+
+      mtr.release_last_page();
+    }
+
+    pages.swap(children);
+    level--;
+  }
+
+  for (const node &n : pages)
+    ctx.bounds.push_back(n.start);
+
+func_exit:
+  mtr.commit();
+  if (offsets_heap)
+    mem_heap_free(offsets_heap);
+  return err;
+}
+
+/** Scan a range of a clustered index.
+@param ctx     scan context
+@param i       the range to scan
+@param worker  number of the worker
+@return error code */
+static dberr_t row_pread_scan_range(row_pread_ctx &ctx, size_t i,
+                                    unsigned worker)
+{
+  dict_index_t *index= ctx.index;
+  const dtuple_t *start= ctx.bounds[i];
+  const dtuple_t *end= i + 1 < ctx.bounds.size() ? ctx.bounds[i + 1] : nullptr;
+  const bool comp= index->table->not_redundant();
+  mem_heap_t *heap= nullptr, *vers_heap= nullptr;
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs *offsets= offsets_;
+  rec_offs_init(offsets_);
+
+  mtr_t mtr{ctx.trx};
+  btr_pcur_t pcur;
+  mtr.start();
+
+  dberr_t err;
+  if (start)
+  {
+    pcur.btr_cur.page_cur.index= index;
+    err= btr_pcur_open_with_no_init(start, PAGE_CUR_GE, BTR_SEARCH_LEAF,
+                                    &pcur, &mtr);
+  }
+  else
+    err= pcur.open_leaf(true, index, BTR_SEARCH_LEAF, &mtr);
+
+  for (const rec_t *rec= err == DB_SUCCESS ? btr_pcur_get_rec(&pcur) : nullptr;
+       err == DB_SUCCESS; )
+  {
+    if (page_rec_is_supremum(rec))
+    {
+      if (ctx.aborted() || trx_is_interrupted(ctx.trx))
+      {
+        err= DB_INTERRUPTED;
+        break;
+      }
+      if (btr_pcur_is_after_last_in_tree(&pcur))
+        break;
+      err= btr_pcur_move_to_next_page(&pcur, &mtr);
+      if (err == DB_SUCCESS)
+        rec= btr_pcur_get_rec(&pcur);
+      continue;
+    }
+
+    if (!page_rec_is_infimum(rec) && !rec_is_metadata(rec, *index))
+    {
+      offsets= rec_get_offsets(rec, index, offsets, index->n_core_fields,
+                               ULINT_UNDEFINED, &heap);
+      if (end && cmp_dtuple_rec(end, rec, index, offsets) <= 0)
+        break;
+
+      const rec_t *vers= rec;
+      if (!ctx.trx->read_view.changes_visible(row_get_rec_trx_id(rec, index,
+                                                                 offsets)))
+      {
+        rec_t *old_vers;
+        if (vers_heap)
+          mem_heap_empty(vers_heap);
+        else
+          vers_heap= mem_heap_create(srv_page_size);
+        /* The following call returns 'offsets' associated with
+        'old_vers' */
+        row_vers_build_for_consistent_read(rec, &mtr, index, &offsets,
+                                           &ctx.trx->read_view, &heap,
+                                           vers_heap, &old_vers, nullptr);
+        vers= old_vers;
+      }
+
+      if (vers && !rec_get_deleted_flag(vers, comp) &&
+          !ctx.callback(vers, offsets, worker, ctx.arg))
+      {
+        err= DB_INTERRUPTED;
+        break;
+      }
+    }
+
+    rec= btr_pcur_move_to_next_on_page(&pcur);
+    if (!rec)
+      err= DB_CORRUPTION;
+  }
+
+  mtr.commit();
+  if (heap)
+    mem_heap_free(heap);
+  if (vers_heap)
+    mem_heap_free(vers_heap);
+  return err;
+}
+
+/** Scan ranges until all of them have been processed.
+@param ctx     scan context
+@param worker  number of the worker */
+static void row_pread_worker(row_pread_ctx &ctx, unsigned worker)
+{
+  while (!ctx.aborted())
+  {
+    const size_t i= ctx.next.fetch_add(1, std::memory_order_relaxed);
+    if (i >= ctx.bounds.size())
+      break;
+    dberr_t err= row_pread_scan_range(ctx, i, worker);
+    if (err != DB_SUCCESS)
+      ctx.abort(err);
+  }
+}
+
+/** Argument of row_pread_task() */
+struct row_pread_task_arg
+{
+  row_pread_ctx *ctx;
+  unsigned worker;
+};
+
+/** srv_thread_pool task for a worker of row_parallel_scan()
+@param arg  row_pread_task_arg */
+static void row_pread_task(void *arg)
+{
+  auto a= static_cast<row_pread_task_arg*>(arg);
+  row_pread_worker(*a->ctx, a->worker);
+}
+
+dberr_t row_parallel_scan(dict_index_t *index, trx_t *trx, unsigned n_workers,
+                          row_pread_callback_t callback, void *arg)
+{
+  ut_ad(index->is_primary());
+  ut_ad(trx->read_view.is_open());
+  ut_ad(n_workers);
+
+  mem_heap_t *heap= mem_heap_create(1024);
+  row_pread_ctx ctx{index, trx, callback, arg};
+  dberr_t err= row_pread_partition(ctx, 4 * size_t{n_workers}, heap);
+
+  if (err == DB_SUCCESS)
+  {
+    n_workers= unsigned(std::min<size_t>(n_workers, ctx.bounds.size()));
+    std::vector<row_pread_task_arg> args(n_workers);
+    std::vector<tpool::waitable_task*> tasks;
+    tasks.reserve(n_workers - 1);
+
+    for (unsigned i= 1; i < n_workers; i++)
+    {
+      args[i]= {&ctx, i};
+      tasks.push_back(new tpool::waitable_task(row_pread_task, &args[i]));
+      srv_thread_pool->submit_task(tasks.back());
+    }
+
+    row_pread_worker(ctx, 0);
+
+    for (tpool::waitable_task *task : tasks)
+    {
+      task->wait();
+      delete task;
+    }
+
+    err= ctx.err;
+  }
+
+  mem_heap_free(heap);
+  return err;
+}
+
+/** Per-worker counter of row_count_parallel() */
+struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) row_count_slot
+{
+  ulint n_rows;
+};
+
+/** row_pread_callback_t of row_count_parallel() */
+static bool row_count_callback(const rec_t *, const rec_offs *,
+                               unsigned worker, void *arg)
+{
+  static_cast<row_count_slot*>(arg)[worker].n_rows++;
+  return true;
+}
+
+dberr_t row_count_parallel(dict_index_t *index, trx_t *trx, unsigned n_workers,
+                           ulint *n_rows)
+{
+  std::vector<row_count_slot> slots(n_workers);
+  dberr_t err= row_parallel_scan(index, trx, n_workers, row_count_callback,
+                                 slots.data());
+  *n_rows= 0;
+  for (const row_count_slot &slot : slots)
+    *n_rows+= slot.n_rows;
+  return err;
+}
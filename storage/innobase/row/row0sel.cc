@@ -3875,12 +3875,17 @@ row_sel_prefetch_cache_init(
 	ulint	i;
 	ulint	sz;
 	byte*	ptr;
+	const ulint n = prebuilt->fetch_cache_batch;
+
+	prebuilt->fetch_cache = static_cast<byte**>(
+		ut_malloc_nokey(n * sizeof *prebuilt->fetch_cache));
+	prebuilt->fetch_cache_alloc = n;
 
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = n * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < n; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3897,6 +3902,54 @@ row_sel_prefetch_cache_init(
 	}
 }
 
+/** Free the row_prebuilt_t::fetch_cache.
+@param prebuilt  prebuilt struct */
+void row_sel_prefetch_cache_free(row_prebuilt_t *prebuilt)
+{
+	if (!prebuilt->fetch_cache) {
+		return;
+	}
+
+	byte*	base = prebuilt->fetch_cache[0] - 4;
+	byte*	ptr = base;
+
+	for (ulint i = 0; i < prebuilt->fetch_cache_alloc; i++) {
+		ulint	magic1 = mach_read_from_4(ptr);
+		ut_a(magic1 == ROW_PREBUILT_FETCH_MAGIC_N);
+		ptr += 4;
+
+		byte*	row = ptr;
+		ut_a(row == prebuilt->fetch_cache[i]);
+		ptr += prebuilt->mysql_row_len;
+
+		ulint	magic2 = mach_read_from_4(ptr);
+		ut_a(magic2 == ROW_PREBUILT_FETCH_MAGIC_N);
+		ptr += 4;
+	}
+
+	ut_free(base);
+	ut_free(prebuilt->fetch_cache);
+	prebuilt->fetch_cache = NULL;
+	prebuilt->fetch_cache_alloc = 0;
+}
+
+/** Determine how many rows to prefetch. The batch size grows with the
+number of rows that were fetched from the cursor, so that short range
+scans do not pay for converting rows that will not be needed, while long
+scans process up to innodb_fetch_cache_rows rows per batch.
+@param prebuilt  prebuilt struct
+@return number of rows to prefetch */
+static ulint row_sel_fetch_cache_batch(const row_prebuilt_t *prebuilt)
+{
+	ulint	max_rows = std::min<ulint>(
+		srv_fetch_cache_rows,
+		MYSQL_FETCH_CACHE_MAX_BYTES / (prebuilt->mysql_row_len + 8));
+
+	max_rows = std::min(max_rows, prebuilt->n_rows_fetched);
+
+	return std::max<ulint>(max_rows, MYSQL_FETCH_CACHE_SIZE);
+}
+
 /********************************************************************//**
 Get the last fetch cache buffer from the queue.
 @return pointer to buffer. */
@@ -3907,12 +3960,13 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_batch);
 
-	if (prebuilt->fetch_cache[0] == NULL) {
+	if (prebuilt->fetch_cache_alloc < prebuilt->fetch_cache_batch) {
 		/* Allocate memory for the fetch cache */
 		ut_ad(prebuilt->n_fetch_cached == 0);
 
+		row_sel_prefetch_cache_free(prebuilt);
 		row_sel_prefetch_cache_init(prebuilt);
 	}
 
@@ -4459,7 +4513,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_batch) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -5648,7 +5703,15 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		if (!prebuilt->n_fetch_cached) {
+			/* Keep the batch size until the cache has been
+			drained, also if innodb_fetch_cache_rows is changed
+			meanwhile. The check for early_not_found above
+			depends on it. */
+			prebuilt->fetch_cache_batch
+				= row_sel_fetch_cache_batch(prebuilt);
+		}
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_cache_batch);
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5700,7 +5763,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_cache_batch) {
 			goto next_rec;
 		}
 	} else {
@@ -692,6 +692,258 @@ bool dtuple_vcol_data_missing(const dtuple_t &tuple,
   return false;
 }
 
+/** A bounded cache of old clustered index record versions that were
+built by row_vers_build_for_consistent_read(). The previous version
+of a record is fully determined by the DB_TRX_ID,DB_ROLL_PTR of the
+newer version, so the entries are independent of any ReadView and can
+be shared by all readers of a hot row. An entry can only be used while
+the undo log record that it was built from is not purgeable. */
+class row_vers_cache_t
+{
+  /** number of independently latched partitions */
+  static constexpr size_t N_PARTS= 64;
+
+  struct entry
+  {
+    /** clustered index identifier */
+    index_id_t index_id;
+    /** dict_table_t::def_trx_id at the time the entry was built */
+    trx_id_t def_trx_id;
+    /** DB_TRX_ID of the newer version */
+    trx_id_t trx_id;
+    /** DB_ROLL_PTR of the newer version */
+    roll_ptr_t roll_ptr;
+    /** rec_offs_extra_size() of the old version */
+    uint32_t extra;
+    /** rec_offs_size() of the old version */
+    uint32_t size;
+    /** the old version of the record, starting at rec_get_start() */
+    byte *data() { return reinterpret_cast<byte*>(this + 1); }
+  };
+
+  struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) part
+  {
+    /** protects the slots and used */
+    srw_mutex mutex;
+    /** the cache slots */
+    entry **slots;
+    /** memory allocated for the cache entries, in bytes */
+    size_t used;
+    /** position of the eviction hand in slots */
+    size_t hand;
+  };
+
+  /** the partitions; nullptr if the cache is disabled */
+  part *parts= nullptr;
+  /** number of slots in each partition */
+  size_t n_slots;
+  /** maximum size of the entries in each partition, in bytes */
+  size_t max_used;
+
+  static size_t fold(index_id_t index_id, trx_id_t trx_id,
+                     roll_ptr_t roll_ptr) noexcept
+  {
+    return size_t(ut_fold_ull((index_id << 48 | trx_id) ^ roll_ptr));
+  }
+
+  /** Free an entry.
+  @param p  partition that the entry belongs to
+  @param e  the entry to be freed */
+  static void free(part &p, entry *e) noexcept
+  {
+    p.used-= sizeof *e + e->size;
+    ut_free(e);
+  }
+public:
+  /** Create the cache.
+  @param size  innodb_undo_version_cache_size */
+  void create(size_t size) noexcept
+  {
+    ut_ad(!parts);
+    if (!size)
+      return;
+    max_used= std::max<size_t>(size / N_PARTS, srv_page_size);
+    n_slots= std::max<size_t>(max_used / 256, 16);
+    parts= static_cast<part*>
+      (aligned_malloc(N_PARTS * sizeof *parts, CPU_LEVEL1_DCACHE_LINESIZE));
+    for (size_t i= 0; i < N_PARTS; i++)
+    {
+      part &p= parts[i];
+      p.mutex.init();
+      p.slots= static_cast<entry**>(ut_zalloc_nokey(n_slots * sizeof *p.slots));
+      p.used= 0;
+      p.hand= 0;
+    }
+  }
+
+  /** Free the cache. */
+  void close() noexcept
+  {
+    if (!parts)
+      return;
+    for (size_t i= 0; i < N_PARTS; i++)
+    {
+      part &p= parts[i];
+      for (size_t s= 0; s < n_slots; s++)
+        if (entry *e= p.slots[s])
+          free(p, e);
+      ut_ad(!p.used);
+      ut_free(p.slots);
+      p.mutex.destroy();
+    }
+    aligned_free(parts);
+    parts= nullptr;
+  }
+
+  /** @return whether the cache is enabled */
+  bool enabled() const noexcept { return parts != nullptr; }
+
+  /** Look up an old version of a record.
+  @param index     clustered index
+  @param trx_id    DB_TRX_ID of the newer version
+  @param roll_ptr  DB_ROLL_PTR of the newer version
+  @param heap      memory heap for allocating the old version
+  @return the old version (with garbage in rec_get_offsets())
+  @retval nullptr  if the version was not found */
+  rec_t *get(const dict_index_t &index, trx_id_t trx_id, roll_ptr_t roll_ptr,
+             mem_heap_t *heap) noexcept
+  {
+    const size_t f= fold(index.id, trx_id, roll_ptr);
+    part &p= parts[f % N_PARTS];
+    rec_t *rec= nullptr;
+    p.mutex.wr_lock();
+    if (const entry *e= p.slots[(f / N_PARTS) % n_slots])
+      if (e->index_id == index.id && e->trx_id == trx_id &&
+          e->roll_ptr == roll_ptr && e->def_trx_id == index.table->def_trx_id)
+      {
+        byte *buf= static_cast<byte*>(mem_heap_alloc(heap, e->size));
+        memcpy(buf, const_cast<entry*>(e)->data(), e->size);
+        rec= buf + e->extra;
+      }
+    p.mutex.wr_unlock();
+    return rec;
+  }
+
+  /** Add an old version of a record to the cache.
+  @param index     clustered index
+  @param trx_id    DB_TRX_ID of the newer version
+  @param roll_ptr  DB_ROLL_PTR of the newer version
+  @param rec       the old version
+  @param offsets   rec_get_offsets(rec, index) */
+  void add(const dict_index_t &index, trx_id_t trx_id, roll_ptr_t roll_ptr,
+           const rec_t *rec, const rec_offs *offsets) noexcept
+  {
+    const uint32_t extra= uint32_t(rec_offs_extra_size(offsets));
+    const uint32_t size= uint32_t(rec_offs_size(offsets));
+    if (sizeof(entry) + size > max_used / 4)
+      return;
+    entry *e= static_cast<entry*>(ut_malloc_nokey(sizeof *e + size));
+    if (UNIV_UNLIKELY(!e))
+      return;
+    e->index_id= index.id;
+    e->def_trx_id= index.table->def_trx_id;
+    e->trx_id= trx_id;
+    e->roll_ptr= roll_ptr;
+    e->extra= extra;
+    e->size= size;
+    memcpy(e->data(), rec - extra, size);
+
+    const size_t f= fold(index.id, trx_id, roll_ptr);
+    part &p= parts[f % N_PARTS];
+    entry **slot= &p.slots[(f / N_PARTS) % n_slots];
+    p.mutex.wr_lock();
+    if (*slot)
+      free(p, *slot);
+    *slot= e;
+    p.used+= sizeof *e + size;
+    /* Evict other entries until we are within the limit. */
+    while (p.used > max_used)
+    {
+      entry **victim= &p.slots[p.hand];
+      if (++p.hand == n_slots)
+        p.hand= 0;
+      if (*victim && *victim != e)
+      {
+        free(p, *victim);
+        *victim= nullptr;
+      }
+    }
+    p.mutex.wr_unlock();
+  }
+};
+
+/** The cache of old versions built for consistent reads */
+static row_vers_cache_t row_vers_cache;
+
+/** Create the cache of old record versions for consistent reads. */
+void row_vers_cache_create() noexcept
+{
+  row_vers_cache.create(srv_undo_version_cache_size);
+}
+
+/** Free the cache of old record versions for consistent reads. */
+void row_vers_cache_close() noexcept
+{
+  row_vers_cache.close();
+}
+
+/** Build the previous version of a clustered index record for
+row_vers_build_for_consistent_read(), possibly using row_vers_cache.
+@param rec       newer version of the record
+@param index     clustered index
+@param offsets   rec_get_offsets(rec, index)
+@param heap      memory heap for allocating the old version
+@param old_vers  the previous version, or nullptr
+@param mtr       mini-transaction
+@param vrow      virtual column info, if any
+@return error code */
+static dberr_t
+row_vers_prev_version(const rec_t *rec, dict_index_t *index, rec_offs *offsets,
+                      mem_heap_t *heap, rec_t **old_vers, mtr_t *mtr,
+                      dtuple_t **vrow)
+{
+  if (vrow || !row_vers_cache.enabled())
+    return trx_undo_prev_version_build(rec, index, offsets, heap, old_vers,
+                                       mtr, 0, nullptr, vrow);
+
+  const roll_ptr_t roll_ptr= row_get_rec_roll_ptr(rec, index, offsets);
+  if (trx_undo_roll_ptr_is_insert(roll_ptr))
+  {
+    *old_vers= nullptr;
+    return DB_SUCCESS;
+  }
+
+  const trx_id_t trx_id= row_get_rec_trx_id(rec, index, offsets);
+  {
+    /* The undo log record (and anything that the old version may
+    refer to) must not be purgeable, like in
+    trx_undo_prev_version_build(). */
+    purge_sys_t::view_guard check{purge_sys_t::view_guard::END_VIEW};
+    if (!check.view().changes_visible(trx_id))
+      if (rec_t *cached= row_vers_cache.get(*index, trx_id, roll_ptr, heap))
+      {
+        *old_vers= cached;
+        return DB_SUCCESS;
+      }
+  }
+
+  dberr_t err= trx_undo_prev_version_build(rec, index, offsets, heap,
+                                           old_vers, mtr, 0, nullptr, nullptr);
+  if (err == DB_SUCCESS && *old_vers)
+  {
+    rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+    rec_offs_init(offsets_);
+    mem_heap_t *offsets_heap= nullptr;
+    const rec_offs *old_offsets=
+      rec_get_offsets(*old_vers, index, offsets_, index->n_core_fields,
+                      ULINT_UNDEFINED, &offsets_heap);
+    row_vers_cache.add(*index, trx_id, roll_ptr, *old_vers, old_offsets);
+    if (offsets_heap)
+      mem_heap_free(offsets_heap);
+  }
+  return err;
+}
+
 /*****************************************************************//**
 Constructs the version of a clustered index record which a consistent
 read should see. We assume that the trx id stored in rec is such that
@@ -756,9 +1008,9 @@ row_vers_build_for_consistent_read(
 		/* If purge can't see the record then we can't rely on
 		the UNDO log record. */
 
-		err = trx_undo_prev_version_build(
+		err = row_vers_prev_version(
 			version, index, *offsets, heap,
-			&prev_version, mtr, 0, NULL, vrow);
+			&prev_version, mtr, vrow);
 
 		if (prev_heap != NULL) {
 			mem_heap_free(prev_heap);
@@ -128,6 +128,12 @@ bool high_level_read_only;
 
 /** Sort buffer size in index creation */
 ulong	srv_sort_buf_size;
+/** Maximum number of threads for merging sorted runs in index creation
+(innodb_merge_sort_threads) */
+ulong	srv_merge_sort_threads;
+/** Maximum number of rows to prefetch for a consistent read
+(innodb_fetch_cache_rows) */
+uint	srv_fetch_cache_rows;
 /** Maximum modification log file size for online index creation */
 unsigned long long	srv_online_max_size;
 
@@ -139,8 +145,13 @@ my_bool	srv_use_native_aio;
 #ifdef __linux__
 /* This enum is defined which linux native io method to use */
 ulong	srv_linux_aio_method;
+/** innodb_io_uring_sqpoll */
+my_bool	srv_io_uring_sqpoll;
+/** innodb_io_uring_fixed */
+my_bool	srv_io_uring_fixed;
 #endif
 my_bool	srv_numa_interleave;
+my_bool	srv_numa_partition;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
 /** innodb_compression_algorithm; used with page compression */
@@ -154,6 +165,14 @@ at startup (while disallowing writes to the redo log). */
 ulonglong	srv_log_file_size;
 /** innodb_flush_log_at_trx_commit */
 ulong		srv_flush_log_at_trx_commit;
+/** innodb_log_compress */
+my_bool		srv_log_compress;
+/** innodb_log_checkpoint_dirty_pages */
+ulong		srv_log_checkpoint_dirty_pages;
+/** innodb_log_archive_dir */
+char*		srv_log_archive_dir;
+/** innodb_log_archive_files */
+ulong		srv_log_archive_files;
 /** innodb_flush_log_at_timeout */
 uint		srv_flush_log_at_timeout;
 /** innodb_page_size */
@@ -197,6 +216,8 @@ ulong	srv_checksum_algorithm;
 uint	srv_n_read_io_threads;
 /** innodb_write_io_threads */
 uint	srv_n_write_io_threads;
+/** innodb_recovery_threads */
+uint	srv_n_recovery_threads;
 
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
@@ -204,6 +225,10 @@ my_bool	srv_random_read_ahead;
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
 ulong	srv_read_ahead_threshold;
+/** innodb_read_ahead_scan_pages; the number of pages to read ahead of
+a persistent cursor that is scanning leaf pages, or 0 to use
+innodb_read_ahead_threshold */
+uint	srv_read_ahead_scan_pages;
 
 /** copy of innodb_open_files; @see innodb_init_params() */
 ulint	srv_max_n_open_files;
@@ -237,6 +262,12 @@ uint srv_n_purge_threads;
 /** innodb_purge_batch_size, in pages */
 ulong	srv_purge_batch_size;
 
+/** innodb_purge_read_ahead */
+my_bool	srv_purge_read_ahead;
+
+/** innodb_undo_version_cache_size */
+ulong	srv_undo_version_cache_size;
+
 /** innodb_stats_method decides how InnoDB treats
 NULL value when collecting statistics. By default, it is set to
 SRV_STATS_NULLS_EQUAL(0), ie. all NULL value are treated equal */
@@ -1115,6 +1146,11 @@ static tpool::waitable_task purge_coordinator_task
 static tpool::task_group purge_truncation_task_group(1);
 static tpool::waitable_task purge_truncation_task
   (purge_truncation_callback, nullptr, &purge_truncation_task_group);
+static void purge_rebuild_callback(void*) { trx_purge_truncate_rebuild(); }
+/** Task for trx_purge_truncate_rebuild(); in purge_truncation_task_group
+so that it will never run concurrently with purge_truncation_callback() */
+static tpool::waitable_task purge_rebuild_task
+  (purge_rebuild_callback, nullptr, &purge_truncation_task_group);
 
 /** Wake up the purge threads if there is work to do. */
 void purge_sys_t::wake_if_not_active()
@@ -1413,18 +1449,22 @@ inline void purge_coordinator_state::do_purge(trx_t *trx)
     no_history:
       srv_dml_needed_delay= 0;
       purge_truncation_task.wait();
-      trx_purge_truncate_history();
+      if (trx_purge_truncate_history())
+        srv_thread_pool->submit_task(&purge_rebuild_task);
       break;
     }
 
     ulint n_pages_handled= trx_purge(trx, n_threads, history_size);
     if (!trx_sys.history_exists())
       goto no_history;
-    if (purge_sys.truncating_tablespace() ||
-        srv_shutdown_state != SRV_SHUTDOWN_NONE)
+    if (purge_sys.truncate_undo_space.rebuild.load(std::memory_order_acquire))
+      /* purge_rebuild_task is in progress; do not wait for it */;
+    else if (purge_sys.truncating_tablespace() ||
+             srv_shutdown_state != SRV_SHUTDOWN_NONE)
     {
       purge_truncation_task.wait();
-      trx_purge_truncate_history();
+      if (trx_purge_truncate_history())
+        srv_thread_pool->submit_task(&purge_rebuild_task);
     }
     else
       srv_thread_pool->submit_task(&purge_truncation_task);
@@ -1532,6 +1572,7 @@ static void srv_shutdown_purge_tasks()
   }
   n_purge_thds= 0;
   purge_truncation_task.wait();
+  purge_rebuild_task.wait();
 }
 
 /**********************************************************************//**
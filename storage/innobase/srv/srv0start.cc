@@ -85,6 +85,7 @@ Created 2/16/1996 Heikki Tuuri
 #include "row0upd.h"
 #include "row0row.h"
 #include "row0mysql.h"
+#include "row0vers.h"
 #include "btr0pcur.h"
 #include "ibuf0ibuf.h"
 #include "zlib.h"
@@ -1433,6 +1434,7 @@ dberr_t srv_start(bool create_new_db)
 	log_sys.create();
 	recv_sys.create();
 	lock_sys.create(srv_lock_table_size = 5 * buf_pool.curr_size());
+	row_vers_cache_create();
 
 	srv_startup_is_before_trx_rollback_phase = true;
 
@@ -2151,6 +2153,7 @@ void innodb_shutdown()
 	trx_sys.close();
 	buf_dblwr.close();
 	lock_sys.close();
+	row_vers_cache_close();
 	trx_pool_close();
 
 	if (!srv_read_only_mode) {
@@ -40,6 +40,7 @@ Created 3/26/1996 Heikki Tuuri
 #include "trx0rseg.h"
 #include "trx0trx.h"
 #include "dict0load.h"
+#include "buf0rea.h"
 #include <mysql/service_thd_mdl.h>
 #include <mysql/service_wsrep.h>
 #include "log.h"
@@ -51,6 +52,68 @@ ulong		srv_max_purge_lag = 0;
 /** Max DML user threads delay in micro-seconds. */
 ulong		srv_max_purge_lag_delay = 0;
 
+/** innodb_max_purge_lag_per_table */
+my_bool		srv_max_purge_lag_per_table;
+
+/** The tables that contributed the most undo log records to the latest
+purge batch, for innodb_max_purge_lag_per_table; written by the purge
+coordinator */
+static struct
+{
+  /** table identifier, or 0 if the entry is unused */
+  Atomic_relaxed<table_id_t> id;
+  /** share of the undo log records in the batch, in 1/1024 */
+  Atomic_relaxed<uint32_t> share;
+} purge_lagging_tables[8];
+
+void trx_purge_clear_lagging() noexcept
+{
+  for (auto &t : purge_lagging_tables)
+    t.id= 0;
+}
+
+/** Update purge_lagging_tables[] after a purge batch.
+@param n_recs  number of undo log records per table
+@param total   total number of undo log records */
+static void
+trx_purge_set_lagging(const std::unordered_map<table_id_t,size_t> &n_recs,
+                      size_t total) noexcept
+{
+  if (!total)
+  {
+    /* The tables of earlier batches are no longer lagging. */
+    trx_purge_clear_lagging();
+    return;
+  }
+  constexpr size_t N{array_elements(purge_lagging_tables)};
+  std::vector<std::pair<size_t,table_id_t>> v;
+  v.reserve(n_recs.size());
+  for (const auto &t : n_recs)
+    v.emplace_back(t.second, t.first);
+  const size_t n{std::min(N, v.size())};
+  std::partial_sort(v.begin(), v.begin() + n, v.end(),
+                    std::greater<std::pair<size_t,table_id_t>>());
+  for (size_t i= 0; i < N; i++)
+  {
+    if (i < n)
+    {
+      purge_lagging_tables[i].share= uint32_t(v[i].first * 1024 / total);
+      purge_lagging_tables[i].id= v[i].second;
+    }
+    else
+      purge_lagging_tables[i].id= 0;
+  }
+}
+
+ulint trx_purge_dml_delay(table_id_t id, ulint delay) noexcept
+{
+  /* A table that produced half of the batch will be delayed fully. */
+  for (const auto &t : purge_lagging_tables)
+    if (t.id == id)
+      return delay * std::min(1024U, 2 * t.share) / 1024;
+  return 0;
+}
+
 /** The global data structure coordinating a purge */
 purge_sys_t	purge_sys;
 
@@ -111,6 +174,7 @@ void purge_sys_t::create()
   mysql_mutex_init(purge_sys_pq_mutex_key, &pq_mutex, nullptr);
   truncate_undo_space.current= nullptr;
   truncate_undo_space.last= 0;
+  truncate_undo_space.rebuild.store(false, std::memory_order_relaxed);
   m_initialized= true;
 }
 
@@ -612,9 +676,14 @@ Remove unnecessary history data from rollback segments. NOTE that when this
 function is called, the caller
 (purge_coordinator_callback or purge_truncation_callback)
 must not have any latches on undo log pages!
+@return whether trx_purge_truncate_rebuild() must be invoked
 */
-void trx_purge_truncate_history()
+bool trx_purge_truncate_history()
 {
+  if (purge_sys.truncate_undo_space.rebuild.load(std::memory_order_acquire))
+    /* purge_rebuild_task will access the rollback segments */
+    return false;
+
   ut_ad(purge_sys.head <= purge_sys.tail);
   purge_sys_t::iterator &head= purge_sys.head.trx_no
     ? purge_sys.head : purge_sys.tail;
@@ -627,7 +696,7 @@ void trx_purge_truncate_history()
   }
 
   if (head.free_history() != DB_SUCCESS)
-    return;
+    return false;
 
   while (fil_space_t *space= purge_sys.truncating_tablespace())
   {
@@ -642,7 +711,7 @@ void trx_purge_truncate_history()
       {
 not_free:
         rseg.latch.rd_unlock();
-        return;
+        return false;
       }
 
       ut_ad(UT_LIST_GET_LEN(rseg.undo_list) == 0);
@@ -681,7 +750,7 @@ void trx_purge_truncate_history()
 
     if (UNIV_UNLIKELY(srv_shutdown_state != SRV_SHUTDOWN_NONE) &&
         srv_fast_shutdown)
-      return;
+      return false;
 
     /* Adjust the tablespace metadata. */
     mysql_mutex_lock(&fil_system.mutex);
@@ -695,53 +764,9 @@ void trx_purge_truncate_history()
     else
       mysql_mutex_unlock(&fil_system.mutex);
 
-    /* Re-initialize tablespace, in a single mini-transaction. */
-    const uint32_t size= SRV_UNDO_TABLESPACE_SIZE_IN_PAGES;
-
-    log_free_check();
-
-    mtr_t mtr{nullptr};
-    mtr.start();
-    mtr.x_lock_space(space);
-    /* Associate the undo tablespace with mtr.
-    During mtr::commit_shrink(), InnoDB can use the undo
-    tablespace object to clear all freed ranges */
-    mtr.set_named_space(space);
-    mtr.trim_pages(page_id_t(space->id, size));
-    ut_a(fsp_header_init(space, size, &mtr) == DB_SUCCESS);
-
-    for (auto &rseg : trx_sys.rseg_array)
+    if (purge_sys.rseg && purge_sys.rseg->space == space)
     {
-      if (rseg.space != space)
-        continue;
-
-      ut_ad(!rseg.is_referenced());
-      /* We may actually have rseg.needs_purge > head.trx_no here
-      if trx_t::commit_empty() had been executed in the past,
-      possibly before this server had been started up. */
-
-      dberr_t err;
-      buf_block_t *rblock= trx_rseg_header_create(space,
-                                                  &rseg - trx_sys.rseg_array,
-                                                  trx_sys.get_max_trx_id(),
-                                                  &mtr, &err);
-      ut_a(rblock);
-      /* These were written by trx_rseg_header_create(). */
-      ut_ad(!mach_read_from_4(TRX_RSEG + TRX_RSEG_FORMAT +
-                              rblock->page.frame));
-      ut_ad(!mach_read_from_4(TRX_RSEG + TRX_RSEG_HISTORY_SIZE +
-                              rblock->page.frame));
-      rseg.reinit(rblock->page.id().page_no());
-    }
-
-    mtr.commit_shrink(*space, size);
-
-    /* No mutex; this is only updated by the purge coordinator. */
-    export_vars.innodb_undo_truncations++;
-
-    if (purge_sys.rseg && purge_sys.rseg->last_page_no == FIL_NULL)
-    {
-      /* If purge_sys.rseg is pointing to rseg that was recently
+      /* If purge_sys.rseg is pointing to rseg that is being
       truncated then move to next rseg element.
 
       Note: Ideally purge_sys.rseg should be NULL because purge should
@@ -751,16 +776,87 @@ void trx_purge_truncate_history()
       purge_sys.next_stored= false;
     }
 
-    DBUG_EXECUTE_IF("ib_undo_trunc",
-                    sql_print_information("InnoDB: ib_undo_trunc");
-                    log_buffer_flush_to_disk();
-                    DBUG_SUICIDE(););
+    if (srv_shutdown_state == SRV_SHUTDOWN_NONE)
+    {
+      /* Let trx_purge_truncate_rebuild() be invoked by
+      purge_rebuild_task, so that the purge of other undo
+      tablespaces can proceed meanwhile. */
+      purge_sys.truncate_undo_space.rebuild.store(true,
+                                                  std::memory_order_relaxed);
+      return true;
+    }
 
-    sql_print_information("InnoDB: Truncated %s", file_name);
-    ut_ad(space == purge_sys.truncate_undo_space.current);
-    purge_sys.truncate_undo_space.current= nullptr;
-    purge_sys.truncate_undo_space.last= space->id - srv_undo_space_id_start;
+    trx_purge_truncate_rebuild();
   }
+
+  return false;
+}
+
+void trx_purge_truncate_rebuild()
+{
+  fil_space_t *space= purge_sys.truncate_undo_space.current;
+  ut_ad(space);
+  const char *file_name= UT_LIST_GET_FIRST(space->chain)->name;
+
+  /* Re-initialize tablespace, in a single mini-transaction. */
+  const uint32_t size= SRV_UNDO_TABLESPACE_SIZE_IN_PAGES;
+
+  log_free_check();
+
+  mtr_t mtr{nullptr};
+  mtr.start();
+  mtr.x_lock_space(space);
+  /* Associate the undo tablespace with mtr.
+  During mtr::commit_shrink(), InnoDB can use the undo
+  tablespace object to clear all freed ranges */
+  mtr.set_named_space(space);
+  mtr.trim_pages(page_id_t(space->id, size));
+  ut_a(fsp_header_init(space, size, &mtr) == DB_SUCCESS);
+
+  for (auto &rseg : trx_sys.rseg_array)
+  {
+    if (rseg.space != space)
+      continue;
+
+    ut_ad(!rseg.is_referenced());
+    /* We may actually have rseg.needs_purge > head.trx_no here
+    if trx_t::commit_empty() had been executed in the past,
+    possibly before this server had been started up. */
+
+    dberr_t err;
+    buf_block_t *rblock= trx_rseg_header_create(space,
+                                                &rseg - trx_sys.rseg_array,
+                                                trx_sys.get_max_trx_id(),
+                                                &mtr, &err);
+    ut_a(rblock);
+    /* These were written by trx_rseg_header_create(). */
+    ut_ad(!mach_read_from_4(TRX_RSEG + TRX_RSEG_FORMAT +
+                            rblock->page.frame));
+    ut_ad(!mach_read_from_4(TRX_RSEG + TRX_RSEG_HISTORY_SIZE +
+                            rblock->page.frame));
+    /* trx_sys.history_size() and others may read the fields
+    concurrently. This page latch is not held by them while they are
+    waiting for rseg.latch, because rseg is not referenced. */
+    rseg.latch.wr_lock(SRW_LOCK_CALL);
+    rseg.reinit(rblock->page.id().page_no());
+    rseg.latch.wr_unlock();
+  }
+
+  mtr.commit_shrink(*space, size);
+
+  /* This may run in purge_rebuild_task or in the purge coordinator. */
+  export_vars.innodb_undo_truncations++;
+
+  DBUG_EXECUTE_IF("ib_undo_trunc",
+                  sql_print_information("InnoDB: ib_undo_trunc");
+                  log_buffer_flush_to_disk();
+                  DBUG_SUICIDE(););
+
+  sql_print_information("InnoDB: Truncated %s", file_name);
+  purge_sys.truncate_undo_space.last= space->id - srv_undo_space_id_start;
+  purge_sys.truncate_undo_space.current= nullptr;
+  purge_sys.truncate_undo_space.rebuild.store(false,
+                                              std::memory_order_release);
 }
 
 buf_block_t *purge_sys_t::get_page(page_id_t id, trx_t *trx)
@@ -776,12 +872,28 @@ buf_block_t *purge_sys_t::get_page(page_id_t id, trx_t *trx)
     if (!undo_page)
       pages.erase(id);
     else
+    {
       h= undo_page;
+      /* The next page of the undo log is likely to be needed soon. */
+      read_ahead(mach_read_from_4(TRX_UNDO_PAGE_HDR + TRX_UNDO_PAGE_NODE +
+                                  FLST_NEXT + FIL_ADDR_PAGE +
+                                  undo_page->page.frame), trx);
+    }
   }
 
   return undo_page;
 }
 
+void purge_sys_t::read_ahead(uint32_t page_no, trx_t *trx) noexcept
+{
+  if (!srv_purge_read_ahead || page_no == FIL_NULL ||
+      page_no >= rseg->space->free_limit)
+    return;
+  const page_id_t id{rseg->space->id, page_no};
+  if (pages.find(id) == pages.end() && rseg->space->acquire())
+    buf_read_page_background(id, rseg->space, trx);
+}
+
 bool purge_sys_t::rseg_get_next_history_log(trx_t *trx) noexcept
 {
   fil_addr_t prev_log_addr;
@@ -819,6 +931,10 @@ bool purge_sys_t::rseg_get_next_history_log(trx_t *trx) noexcept
     {
       const byte *log_hdr= undo_page->page.frame + prev_log_addr.boffset;
       trx_no= mach_read_from_8(log_hdr + TRX_UNDO_TRX_NO);
+      /* Read ahead the header of the preceding undo log in the history. */
+      if (trx_no)
+        read_ahead(flst_get_prev_addr(log_hdr + TRX_UNDO_HISTORY_NODE).page,
+                   trx);
     }
 
     if (UNIV_LIKELY(trx_no != 0))
@@ -1218,6 +1334,11 @@ trx_purge_attach_undo_recs(trx_t *trx, ulint *n_work_items) noexcept
 
   std::unordered_map<table_id_t, purge_node_t *>
     table_id_map(TRX_PURGE_TABLE_BUCKETS);
+  /* number of undo log records per table, for
+  innodb_max_purge_lag_per_table */
+  std::unordered_map<table_id_t, size_t> n_recs;
+  size_t n_total= 0;
+  const bool per_table{srv_max_purge_lag_per_table && srv_max_purge_lag};
   purge_sys.m_active= true;
 
   for (THD *const thd{trx->mysql_thd};
@@ -1268,6 +1389,11 @@ trx_purge_attach_undo_recs(trx_t *trx, ulint *n_work_items) noexcept
     enqueue:
       table_node->undo_recs.push(purge_rec);
       ut_ad(!table_node->in_progress);
+      if (per_table)
+      {
+        n_recs[table_id]++;
+        n_total++;
+      }
     }
 
     const size_t size{purge_sys.n_pages_handled()};
@@ -1276,6 +1402,8 @@ trx_purge_attach_undo_recs(trx_t *trx, ulint *n_work_items) noexcept
       break;
   }
 
+  trx_purge_set_lagging(n_recs, n_total);
+
 #ifdef UNIV_DEBUG
   thr= UT_LIST_GET_FIRST(purge_sys.query->thrs);
   for (ulint i= 0; thr && i < *n_work_items;
@@ -1841,6 +1841,7 @@ trx_undo_report_row_operation(
 	transaction modifies this table. */
 	auto m = trx->mod_tables.emplace(index->table, trx->undo_no);
 	ut_ad(m.first->second.valid(trx->undo_no));
+	m.first->second.start_modifying(index->table);
 
 	if (m.second && index->table->is_native_online_ddl()) {
 		trx->apply_online_log= true;
@@ -1957,6 +1958,8 @@ trx_undo_report_row_operation(
 				if (m.second) {
 					/* We are not going to modify
 					this table after all. */
+					m.first->second.stop_modifying(
+						index->table);
 					trx->mod_tables.erase(m.first);
 				}
 
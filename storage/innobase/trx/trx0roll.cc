@@ -144,6 +144,7 @@ dberr_t trx_t::rollback_low(const undo_no_t *savept) noexcept
       if (j->second.rollback(limit))
       {
         j->second.clear_bulk_buffer();
+        j->second.stop_modifying(j->first);
         mod_tables.erase(j);
       }
       else if (!apply_online_log)
@@ -156,6 +156,8 @@ trx_init(
 
 	trx->lock.rec_cached = 0;
 
+	UT_LIST_INIT(trx->lock.free_rec_locks, &lock_t::trx_locks);
+
 	trx->lock.table_cached = 0;
 #ifdef WITH_WSREP
 	ut_ad(!trx->wsrep);
@@ -635,7 +637,13 @@ static dberr_t trx_resurrect_table_locks(trx_t *trx, const trx_undo_t &undo)
       }
 
       if (trx->state == TRX_STATE_PREPARED)
-        trx->mod_tables.emplace(table, 0);
+        trx->mod_tables.emplace(table, 0).first->second.
+          start_modifying(table);
+      else
+        /* The recovered transaction will be rolled back without
+        any trx_t::mod_tables entry. Keep this table on the slow path
+        of lock_sec_rec_some_has_impl() until it is evicted. */
+        table->n_active_modifiers++;
 
       lock_table_resurrect(table, trx, p.second ? LOCK_X : LOCK_IX);
 
@@ -1527,6 +1535,9 @@ bool trx_t::commit_cleanup() noexcept
     pages_accessed= 0;
     buf_pool.stat.n_page_gets+= n_page_gets;
   }
+  for (auto &t : mod_tables)
+    t.second.stop_modifying(t.first);
+
   mutex.wr_lock();
   state= TRX_STATE_NOT_STARTED;
   *detailed_error= '\0';
@@ -391,8 +391,21 @@ int json_read_string_const_chr(json_string_t *js)
 static int skip_str_constant(json_engine_t *j)
 {
   int t, c_len, *value_ptr= NULL;
+  /*
+    In the ASCII-based multibyte charsets (utf8mb3, utf8mb4, the CJK ones)
+    a byte below 128 is always a complete character, so the runs of
+    ordinary characters are skipped without calling the mb_wc function.
+  */
+  const my_bool ascii_based= j->s.cs->mbminlen == 1 && j->s.cs->mbmaxlen > 1;
   for (;;)
   {
+    if (ascii_based)
+    {
+      const uchar *c= j->s.c_str;
+      while (c < j->s.str_end && *c < 128 && json_instr_chr_map[*c] <= S_ETC)
+        c++;
+      j->s.c_str= c;
+    }
     if ((c_len= json_next_char(&j->s)) > 0)
     {
       j->s.c_str+= c_len;
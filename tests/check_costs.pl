@@ -25,6 +25,12 @@
 # - Index scan of the table
 #
 # The output can be used to finetune the optimizer cost variables.
+# With --profile=file the program also writes an option file with the
+# engine cost variables scaled by the measured time/cost ratios, which
+# can be included in the server configuration of hosts with the same
+# hardware. --disk-read-file=file adds optimizer_disk_read_cost, measured
+# by random 4K reads of an existing big file that is not in the file
+# system cache (for example a file bigger than the memory of the host).
 #
 # The table in question is a similar to the 'lineitem' table used by DBT3
 # it has 16 field and could be regarded as a 'average kind of table'.
@@ -36,6 +42,7 @@
 use DBI;
 use Getopt::Long;
 use Benchmark ':hireswallclock';
+use Time::HiRes;
 
 package main;
 
@@ -60,6 +67,8 @@ $opt_grof= undef;
 $opt_all_tests=undef;
 $opt_ratios= undef;
 $opt_mysql= undef;
+$opt_profile= undef;
+$opt_disk_read_file= undef;
 $has_force_index=1;
 
 @arguments= @ARGV;
@@ -69,6 +78,7 @@ GetOptions("host=s","user=s","password=s", "rows=i","test-runs=i","socket=s",
            "init-query=s","engine=s","comment=s",
            "gprof", "one-test=s",
            "mysql", "all-tests", "ratios", "where-check",
+           "profile=s", "disk-read-file=s",
            "analyze", "verbose") ||
     die "Aborted";
 
@@ -221,6 +231,8 @@ else
     print_totals();
 }
 
+write_profile($opt_profile) if (defined($opt_profile));
+
 $dbh->do("drop table if exists $table") if (!defined($opt_skip_drop));
 $dbh->disconnect; $dbh=0;	# Close handler
 exit(0);
@@ -363,6 +375,94 @@ sub test_engine()
             print_costs($test_names[$j], $res[$i][$j]);
         }
     }
+    add_to_profile($i, $engine) if (defined($opt_profile) && !$opt_mysql);
+}
+
+
+#
+# Scale the cost variable of each test with the time/cost ratio of it.
+# This is a first approximation; the other costs of the query plan are
+# scaled with it.
+#
+
+sub add_to_profile()
+{
+    my ($index, $engine)= @_;
+    my ($j, $name, $cost, $value);
+    # Engine cost variables that dominate the cost of a test
+    my %profile_variables=
+        ("table scan"          => "optimizer_row_next_find_cost",
+         "index scan"          => "optimizer_key_next_find_cost",
+         "eq_ref_index_join"   => "optimizer_key_lookup_cost",
+         "eq_ref_join"         => "optimizer_row_lookup_cost");
+
+    for ($j= $where_tests+1 ; $j <= $#test_names ; $j++)
+    {
+        $name= $profile_variables{$test_names[$j]};
+        next if (!defined($name) || !$res[$index][$j]);
+        $cost= $res[$index][$j]->{'cost'} - $res[$index][$j]->{'where_cost'};
+        next if ($cost <= 0);
+        $value= get_variable("$engine.$name");
+        push(@profile, sprintf("%s.%s=%.6f", $engine, $name,
+                               $value * $res[$index][$j]->{'time'} / $cost));
+    }
+}
+
+
+sub write_profile()
+{
+    my ($file)= @_;
+    my ($line);
+
+    open(PROFILE, ">$file") || die "Can't create profile $file: $!\n";
+    print PROFILE "# Optimizer cost profile generated by check_costs.pl\n";
+    print PROFILE "# Rows: $opt_rows  Arguments: @arguments\n";
+    print PROFILE "[mariadb]\n";
+    if (defined($where_cost) && defined($perf_ratio) && !$opt_mysql)
+    {
+        printf PROFILE "optimizer_where_cost=%.6f\n", $where_cost * $perf_ratio;
+    }
+    if (defined($opt_disk_read_file))
+    {
+        printf PROFILE "optimizer_disk_read_cost=%.6f\n",
+            get_disk_read_cost($opt_disk_read_file);
+    }
+    foreach $line (@profile)
+    {
+        print PROFILE "$line\n";
+    }
+    close(PROFILE);
+    print "Wrote optimizer cost profile to $file\n";
+}
+
+
+# Return the time in microseconds for a random 4K read of a file
+
+sub get_disk_read_cost()
+{
+    my ($file)= @_;
+    my ($size, $blocks, $i, $buff, $start, $time, $loops);
+
+    $loops= 10000;
+    open(DISK_FILE, "<$file") || die "Can't open $file: $!\n";
+    binmode(DISK_FILE);
+    $size= -s DISK_FILE;
+    $blocks= int($size / 4096);
+    die "File $file is too small for measuring disk reads\n"
+        if ($blocks < $loops);
+
+    $start= [Time::HiRes::gettimeofday()];
+    for ($i= 0 ; $i < $loops ; $i++)
+    {
+        sysseek(DISK_FILE, int(rand($blocks)) * 4096, 0) ||
+            die "Got error on seek in $file: $!\n";
+        defined(sysread(DISK_FILE, $buff, 4096)) ||
+            die "Got error on read from $file: $!\n";
+    }
+    $time= Time::HiRes::tv_interval($start) * 1000000.0 / $loops;
+    close(DISK_FILE);
+    printf "Disk read cost: %6.4f usec per 4K block\n", $time;
+    return $time;
 }
 
 
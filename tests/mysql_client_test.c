@@ -38,6 +38,7 @@
 #include "mysql_client_fw.c"
 #ifndef _WIN32
 #include <arpa/inet.h>
+#include <poll.h>
 #endif
 
 #include "my_valgrind.h"
@@ -23200,6 +23201,102 @@ static void test_mdev35953()
 }
 #endif
 
+#if !defined(EMBEDDED_LIBRARY) && !defined(_WIN32)
+/* Read len bytes from the socket, waiting no more than 10 seconds */
+static my_bool pipeline_read(my_socket fd, uchar *buf, size_t len)
+{
+  while (len)
+  {
+    struct pollfd pfd;
+    ssize_t n;
+    pfd.fd= fd;
+    pfd.events= POLLIN;
+    pfd.revents= 0;
+    if (poll(&pfd, 1, 10000) != 1 || (n= recv(fd, buf, len, 0)) <= 0)
+      return 0;
+    buf+= n;
+    len-= (size_t) n;
+  }
+  return 1;
+}
+
+/* Read a reply packet and check that it is an OK packet */
+static my_bool pipeline_read_ok(my_socket fd)
+{
+  uchar buf[256];
+  size_t len;
+  if (!pipeline_read(fd, buf, 4))
+    return 0;
+  len= uint3korr(buf);
+  return len && len <= sizeof buf && pipeline_read(fd, buf, len) && !buf[0];
+}
+
+/*
+  Replies to pipelined commands may be sent together, but every reply
+  must arrive without the client sending anything more.
+*/
+static void test_pipelined_replies()
+{
+  MYSQL *m;
+  my_socket fd;
+  uchar batch[64];
+  size_t len= 0;
+  int i;
+  static const uchar query[]= { 5, 0, 0, 0, COM_QUERY, 'D', 'O', ' ', '1' };
+  static const uchar stmt_close[]= { 5, 0, 0, 0, COM_STMT_CLOSE, 0, 0, 0, 0 };
+  static const uchar ping[]= { 1, 0, 0, 0, COM_PING };
+
+  myheader("test_pipelined_replies");
+
+  m= mysql_client_init(NULL);
+  DIE_UNLESS(m);
+  if (!mysql_real_connect(m, opt_host, opt_user, opt_password, current_db,
+                          opt_port, opt_unix_socket, 0))
+  {
+    myerror("connection failed");
+    exit(1);
+  }
+  if (mysql_get_ssl_cipher(m))
+  {
+    /* The packets are written to the socket directly */
+    mysql_close(m);
+    return;
+  }
+  fd= mysql_get_socket(m);
+
+  /* A batch of queries, a COM_STMT_CLOSE (no reply) and a COM_PING */
+  for (i= 0; i < 3; i++, len+= sizeof query)
+    memcpy(batch + len, query, sizeof query);
+  memcpy(batch + len, stmt_close, sizeof stmt_close);
+  len+= sizeof stmt_close;
+  memcpy(batch + len, ping, sizeof ping);
+  len+= sizeof ping;
+  DIE_UNLESS(send(fd, batch, len, 0) == (ssize_t) len);
+  for (i= 0; i < 4; i++)
+    DIE_UNLESS(pipeline_read_ok(fd));
+
+  /* A query followed by a COM_STMT_CLOSE, which is not answered */
+  memcpy(batch, query, sizeof query);
+  memcpy(batch + sizeof query, stmt_close, sizeof stmt_close);
+  len= sizeof query + sizeof stmt_close;
+  DIE_UNLESS(send(fd, batch, len, 0) == (ssize_t) len);
+  DIE_UNLESS(pipeline_read_ok(fd));
+
+  /* A query followed by an incomplete packet */
+  memcpy(batch, query, sizeof query);
+  memcpy(batch + sizeof query, ping, 2);
+  len= sizeof query + 2;
+  DIE_UNLESS(send(fd, batch, len, 0) == (ssize_t) len);
+  DIE_UNLESS(pipeline_read_ok(fd));
+  DIE_UNLESS(send(fd, ping + 2, sizeof ping - 2, 0) ==
+             (ssize_t) (sizeof ping - 2));
+  DIE_UNLESS(pipeline_read_ok(fd));
+
+  mysql_close(m);
+}
+#endif
+
+
 static struct my_tests_st my_tests[]= {
   { "test_mdev_20516", test_mdev_20516 },
   { "test_mdev24827", test_mdev24827 },
@@ -23523,6 +23620,9 @@ static struct my_tests_st my_tests[]= {
 #ifndef EMBEDDED_LIBRARY
   { "test_mdev_36080", test_mdev_36080},
   { "test_mdev35953", test_mdev35953 },
+#endif
+#if !defined(EMBEDDED_LIBRARY) && !defined(_WIN32)
+  { "test_pipelined_replies", test_pipelined_replies },
 #endif
   { 0, 0 }
 };
@@ -177,6 +177,10 @@ class aio_libaio final : public aio
     io_prep_pread(&cb->m_iocb, cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
     if (cb->m_opcode != aio_opcode::AIO_PREAD)
       cb->m_iocb.aio_lio_opcode= IO_CMD_PWRITE;
+#ifdef RWF_ATOMIC
+    if (cb->m_opcode == aio_opcode::AIO_PWRITE_ATOMIC)
+      cb->m_iocb.aio_rw_flags= RWF_ATOMIC;
+#endif
     iocb *icb= &cb->m_iocb;
     int ret= io_submit(m_io_ctx, 1, &icb);
     if (ret == 1)
@@ -22,11 +22,14 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 
 #include <liburing.h>
 #include <pthread.h>
+#include <sys/resource.h>
 
 #include <algorithm>
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <stdexcept>
 #include <my_sys.h>
 
@@ -39,7 +42,14 @@ class aio_uring final : public aio
 public:
   aio_uring(thread_pool *tpool, int max_aio) : tpool_(tpool)
   {
-    if (const auto e= io_uring_queue_init(max_aio, &uring_, 0))
+    const unsigned options= tpool->uring_options();
+    io_uring_params params{};
+    if (options & URING_SQPOLL)
+    {
+      params.flags= IORING_SETUP_SQPOLL;
+      params.sq_thread_idle= 1000;
+    }
+    if (const auto e= io_uring_queue_init_params(max_aio, &uring_, &params))
     {
       switch (-e) {
       case ENOMEM:
@@ -63,6 +73,15 @@ class aio_uring final : public aio
                         ME_ERROR_LOG | ME_WARNING);
         break;
       case EPERM:
+        if (options & URING_SQPOLL)
+        {
+          my_printf_error(ER_UNKNOWN_ERROR,
+                          "io_uring_queue_init() failed with EPERM:"
+                          " IORING_SETUP_SQPOLL may require CAP_SYS_NICE"
+                          " on kernels older than 5.11",
+                          ME_ERROR_LOG | ME_WARNING);
+          break;
+        }
 	my_printf_error(ER_UNKNOWN_ERROR,
                         "io_uring_queue_init() failed with EPERM:"
 			" sysctl kernel.io_uring_disabled has the value 2, "
@@ -88,6 +107,9 @@ class aio_uring final : public aio
                       ME_ERROR_LOG | ME_WARNING, errno);
     }
 
+    if (options & URING_FIXED)
+      register_file_table();
+
     thread_= std::thread(thread_routine, this);
   }
   const char *get_implementation() const override { return "io_uring"; };
@@ -110,6 +132,7 @@ class aio_uring final : public aio
       }
     }
     thread_.join();
+    /* io_uring_queue_exit() releases any registered buffers and files. */
     io_uring_queue_exit(&uring_);
   }
 
@@ -123,10 +146,33 @@ class aio_uring final : public aio
     std::lock_guard<std::mutex> _(mutex_);
 
     io_uring_sqe *sqe= io_uring_get_sqe(&uring_);
+    const int buf_index= find_buffer(cb->m_buffer, cb->m_len);
     if (cb->m_opcode == aio_opcode::AIO_PREAD)
-      io_uring_prep_readv(sqe, cb->m_fh, &cb->m_iovec, 1, cb->m_offset);
+    {
+      if (buf_index >= 0)
+        io_uring_prep_read_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                                 cb->m_offset, buf_index);
+      else
+        io_uring_prep_readv(sqe, cb->m_fh, &cb->m_iovec, 1, cb->m_offset);
+    }
     else
-      io_uring_prep_writev(sqe, cb->m_fh, &cb->m_iovec, 1, cb->m_offset);
+    {
+      if (buf_index >= 0)
+        io_uring_prep_write_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                                  cb->m_offset, buf_index);
+      else
+        io_uring_prep_writev(sqe, cb->m_fh, &cb->m_iovec, 1, cb->m_offset);
+#ifdef RWF_ATOMIC
+      if (cb->m_opcode == aio_opcode::AIO_PWRITE_ATOMIC)
+        sqe->rw_flags= RWF_ATOMIC;
+#endif
+    }
+    if (is_registered(cb->m_fh))
+    {
+      /* The registered file table is indexed by the file descriptor. */
+      sqe->fd= cb->m_fh;
+      sqe->flags|= IOSQE_FIXED_FILE;
+    }
     io_uring_sqe_set_data(sqe, cb);
 
     return io_uring_submit(&uring_) == 1 ? 0 : -1;
@@ -134,25 +180,120 @@ class aio_uring final : public aio
 
   int bind(native_file_handle &fd) final
   {
+    if (unsigned(fd) >= n_files_)
+      return 0;
     std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(it == files_.end() || *it != fd);
-    files_.insert(it, fd);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    int ret= io_uring_register_files_update(&uring_, unsigned(fd), &fd, 1);
+    if (ret == 1)
+    {
+      files_[fd].store(true, std::memory_order_relaxed);
+      return 0;
+    }
+    return ret;
   }
 
   int unbind(const native_file_handle &fd) final
   {
+    if (unsigned(fd) >= n_files_ ||
+        !files_[fd].load(std::memory_order_relaxed))
+      return 0;
     std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(*it == fd);
-    files_.erase(it);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    files_[fd].store(false, std::memory_order_relaxed);
+    int none= -1;
+    int ret= io_uring_register_files_update(&uring_, unsigned(fd), &none, 1);
+    return ret == 1 ? 0 : ret;
+  }
+
+  int register_buffers(void *buf, size_t size) final
+  {
+    if (!(tpool_->uring_options() & URING_FIXED))
+      return 0;
+    {
+      std::lock_guard<std::mutex> _(mutex_);
+      if (buffers_.empty() && !buf)
+        return 0;
+      buffers_.clear();
+    }
+    /* No new requests will refer to the buffers. The kernel will
+    wait for any pending fixed-buffer requests to complete. */
+    if (buffers_registered_)
+    {
+      io_uring_unregister_buffers(&uring_);
+      buffers_registered_= false;
+    }
+    if (!buf)
+      return 0;
+
+    std::vector<iovec> iov;
+    for (size_t offset= 0; offset < size; offset+= MAX_BUFFER_SIZE)
+      iov.push_back({static_cast<char*>(buf) + offset,
+                     std::min(size - offset, MAX_BUFFER_SIZE)});
+
+    if (int ret= io_uring_register_buffers(&uring_, iov.data(),
+                                           unsigned(iov.size())))
+    {
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring_register_buffers() failed with errno %d:"
+                      " try larger memory locked limit, ulimit -l"
+                      " (continuing without registered buffers)",
+                      ME_ERROR_LOG | ME_WARNING, -ret);
+      return ret;
+    }
+
+    buffers_registered_= true;
+    std::lock_guard<std::mutex> _(mutex_);
+    buffers_= std::move(iov);
+    return 0;
   }
 
 private:
+  /** Maximum size of a registered buffer */
+  static constexpr size_t MAX_BUFFER_SIZE= size_t{1} << 30;
+  /** Maximum size of the registered file table */
+  static constexpr unsigned MAX_FILES= 65536;
+
+  /** Register a sparse file table that is indexed by file descriptor. */
+  void register_file_table()
+  {
+    rlimit rl;
+    unsigned n= MAX_FILES;
+    if (!getrlimit(RLIMIT_NOFILE, &rl) && rl.rlim_cur < n)
+      n= unsigned(rl.rlim_cur);
+    std::vector<int> fds(n, -1);
+    if (int ret= io_uring_register_files(&uring_, fds.data(), n))
+    {
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring_register_files() failed with errno %d"
+                      " (continuing without registered files)",
+                      ME_ERROR_LOG | ME_WARNING, -ret);
+      return;
+    }
+    files_.reset(new std::atomic<bool>[n]());
+    n_files_= n;
+  }
+
+  /** @return whether a file descriptor has been registered */
+  bool is_registered(native_file_handle fd) const
+  {
+    return unsigned(fd) < n_files_ &&
+      files_[fd].load(std::memory_order_relaxed);
+  }
+
+  /** Look up a registered buffer; the caller must hold mutex_.
+  @return index of the registered buffer
+  @retval -1 if the range is not within a registered buffer */
+  int find_buffer(const void *buf, size_t len) const
+  {
+    const char *b= static_cast<const char*>(buf);
+    for (size_t i= 0; i < buffers_.size(); i++)
+    {
+      const char *start= static_cast<const char*>(buffers_[i].iov_base);
+      if (b >= start && b + len <= start + buffers_[i].iov_len)
+        return int(i);
+    }
+    return -1;
+  }
+
   static void thread_routine(aio_uring *aio)
   {
     my_thread_set_name("io_uring_wait");
@@ -209,7 +350,15 @@ class aio_uring final : public aio
   thread_pool *tpool_;
   std::thread thread_;
 
-  std::vector<native_file_handle> files_;
+  /** registered buffers; protected by mutex_ */
+  std::vector<iovec> buffers_;
+  /** whether io_uring_register_buffers() succeeded */
+  bool buffers_registered_= false;
+  /** registered file descriptors, or nullptr */
+  std::unique_ptr<std::atomic<bool>[]> files_;
+  /** size of files_ */
+  unsigned n_files_= 0;
+  /** serializes bind() and unbind() */
   std::mutex files_mutex_;
 };
 
@@ -189,6 +189,16 @@ void aio::synchronous(aiocb *cb)
   case aio_opcode::AIO_PWRITE:
     ret_len= pwrite(cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
     break;
+  case aio_opcode::AIO_PWRITE_ATOMIC:
+#ifdef RWF_ATOMIC
+    {
+      iovec iov{cb->m_buffer, cb->m_len};
+      ret_len= pwritev2(cb->m_fh, &iov, 1, off_t(cb->m_offset), RWF_ATOMIC);
+    }
+#else
+    ret_len= pwrite(cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
+#endif
+    break;
   default:
     abort();
   }
@@ -22,8 +22,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #ifdef HAVE_LIBAIO
 #include <libaio.h>
 #endif
-#ifdef HAVE_URING
-#include <sys/uio.h>
+#ifdef __linux__
+#include <sys/uio.h> /* RWF_ATOMIC */
 #endif
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -134,7 +134,9 @@ class waitable_task :public task
 enum class aio_opcode
 {
   AIO_PREAD,
-  AIO_PWRITE
+  AIO_PWRITE,
+  /** A write that must not be torn (RWF_ATOMIC on Linux) */
+  AIO_PWRITE_ATOMIC
 };
 constexpr size_t MAX_AIO_USERDATA_LEN= 4 * sizeof(void*);
 
@@ -201,6 +203,13 @@ class aio
   virtual int bind(native_file_handle &fd)= 0;
   /** "Unind" file to AIO handler (used on Windows only) */
   virtual int unbind(const native_file_handle &fd)= 0;
+  /**
+    Register a memory range that will be used as I/O buffers
+    (used with io_uring only).
+    @param buf   start of the range, or nullptr to unregister
+    @param size  size of the range in bytes
+    @return 0 on success, or an error code */
+  virtual int register_buffers(void *buf, size_t size) { return 0; }
   virtual const char *get_implementation() const=0;
   virtual ~aio(){};
 protected:
@@ -230,12 +239,23 @@ enum aio_implementation
 #endif
 };
 
+/** Flags for configuring io_uring */
+enum aio_uring_options
+{
+  /** Use a kernel thread for polling the submission queue */
+  URING_SQPOLL= 1,
+  /** Use registered buffers and files */
+  URING_FIXED= 2
+};
+
 class thread_pool
 {
 protected:
   /* AIO handler */
   std::unique_ptr<aio> m_aio{};
   aio_implementation m_aio_impl= OS_IO_DEFAULT;
+  /** aio_uring_options */
+  unsigned m_uring_options= 0;
   virtual aio *create_native_aio(int max_io, aio_implementation)= 0;
 
 public:
@@ -285,6 +305,10 @@ class thread_pool
   {
     m_aio.reset();
   }
+  /** Set the aio_uring_options for subsequent configure_aio() */
+  void set_uring_options(unsigned options) { m_uring_options= options; }
+  /** @return the aio_uring_options */
+  unsigned uring_options() const { return m_uring_options; }
   const char *get_aio_implementation() const
   {
     return m_aio->get_implementation();
@@ -307,7 +331,9 @@ class thread_pool
   */
   virtual void set_concurrency(unsigned int threads=0){}
 
-  int bind(native_file_handle &fd) { return m_aio->bind(fd); }
+  int bind(native_file_handle &fd) { return m_aio ? m_aio->bind(fd) : 0; }
+  int register_buffers(void *buf, size_t size)
+  { return m_aio ? m_aio->register_buffers(buf, size) : 0; }
   void unbind(const native_file_handle &fd) { if (m_aio) m_aio->unbind(fd); }
   int submit_io(aiocb *cb) { return m_aio->submit_io(cb); }
   virtual void wait_begin() {};
@@ -106,6 +106,26 @@ test_json_parsing(json_engine_t *je)
 }
 
 
+static const uchar *sj0= (const uchar *) "[\"plain text\", \"a\\\"b\\\\\","
+                                         " \"\xc3\xa9t\xc3\xa9\", \"x\"]";
+static const uchar *sj1= (const uchar *) "[\"tab\there\"]";
+static const uchar *sj2= (const uchar *) "[\"unterminated";
+/*
+  Test scanning of string constants.
+*/
+static void
+test_string_scanning(json_engine_t *je)
+{
+  struct st_parse_result r;
+  parse_json(sj0, &r, je);
+  ok(r.error == 0 && r.n_values == 5, "strings");
+  parse_json(sj1, &r, je);
+  ok(r.error == JE_NOT_JSON_CHR, "control character in a string");
+  parse_json(sj2, &r, je);
+  ok(r.error == JE_EOS, "unterminated string");
+}
+
+
 static const uchar *p0= (const uchar *) "$.key1[12].*[*]";
 /*
   Test json_lib functions to parse JSON path.
@@ -201,10 +221,11 @@ int main()
 
   ci= &my_charset_utf8mb3_general_ci;
 
-  plan(6);
+  plan(9);
   diag("Testing json_lib functions.");
 
   test_json_parsing(&je);
+  test_string_scanning(&je);
   test_path_parsing(&p);
   test_search(&array_counters, &je, &p);
 
@@ -0,0 +1,146 @@
+/* Copyright (c) 2026, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Micro-benchmarks of mysys primitives.
+
+  Every benchmark does a fixed amount of work with fixed input, checks
+  the result and reports the elapsed time with diag(), so that the output
+  of two builds can be compared line by line. Only the correctness
+  checks affect the test result; the timings are informational.
+
+  The amount of work can be scaled with the first argument, for example
+  "bench-t 10" runs every benchmark ten times longer.
+*/
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <lf.h>
+#include <tap.h>
+#include <stdlib.h>
+
+static uint scale= 1;
+
+static void report(const char *name, ulonglong start, ulonglong ops,
+                   const char *unit)
+{
+  ulonglong ns= my_interval_timer() - start;
+  diag("%-24s %12llu %-6s %10.2f ns/%s", name, ops, unit,
+       ops ? (double) ns / (double) ops : 0.0, unit);
+}
+
+static uint32 bench_checksum(const char *name,
+                             uint32 (*func)(uint32, const void *, size_t),
+                             const uchar *buf, size_t len)
+{
+  uint32 crc= 0;
+  uint i, n= 2000 * scale;
+  ulonglong start= my_interval_timer();
+  for (i= 0; i < n; i++)
+    crc= func(crc, buf, len);
+  report(name, start, (ulonglong) n * len / 1024, "KiB");
+  return crc;
+}
+
+static void bench_crc(void)
+{
+  static uchar buf[64 * 1024];
+  size_t i;
+  uint32 crc1, crc2;
+
+  for (i= 0; i < sizeof buf; i++)
+    buf[i]= (uchar) (i % 251);
+
+  crc1= bench_checksum("my_checksum", my_checksum, buf, sizeof buf);
+  crc2= bench_checksum("my_checksum", my_checksum, buf, sizeof buf);
+  ok(crc1 == crc2, "my_checksum is repeatable");
+  crc1= bench_checksum("my_crc32c", my_crc32c, buf, sizeof buf);
+  crc2= bench_checksum("my_crc32c", my_crc32c, buf, sizeof buf);
+  ok(crc1 == crc2, "my_crc32c is repeatable");
+}
+
+static void bench_alloc_root(void)
+{
+  MEM_ROOT root;
+  uint round, i, n= 100000, failed= 0;
+  ulonglong start;
+
+  init_alloc_root(PSI_NOT_INSTRUMENTED, &root, 8192, 0, MYF(0));
+  start= my_interval_timer();
+  for (round= 0; round < 10 * scale; round++)
+  {
+    for (i= 0; i < n; i++)
+      if (!alloc_root(&root, 8 + (i & 63)))
+        failed++;
+    free_root(&root, MYF(MY_MARK_BLOCKS_FREE));
+  }
+  report("alloc_root", start, (ulonglong) n * 10 * scale, "alloc");
+  free_root(&root, MYF(0));
+  ok(!failed, "alloc_root");
+}
+
+static void bench_lf_hash(void)
+{
+  LF_HASH hash;
+  LF_PINS *pins;
+  uint i, round, n= 100000, missing= 0;
+  ulonglong start;
+
+  lf_hash_init(&hash, sizeof(uint), LF_HASH_UNIQUE, 0, sizeof(uint), 0,
+               &my_charset_bin);
+  pins= lf_hash_get_pins(&hash);
+
+  start= my_interval_timer();
+  for (i= 0; i < n; i++)
+    lf_hash_insert(&hash, pins, &i);
+  report("lf_hash_insert", start, n, "op");
+
+  start= my_interval_timer();
+  for (round= 0; round < 10 * scale; round++)
+    for (i= 0; i < n; i++)
+    {
+      uint k= (i * 2654435761U) % n;
+      void *found= lf_hash_search(&hash, pins, &k, sizeof k);
+      if (!found || found == MY_ERRPTR)
+        missing++;
+      lf_hash_search_unpin(pins);
+    }
+  report("lf_hash_search", start, (ulonglong) n * 10 * scale, "op");
+
+  start= my_interval_timer();
+  for (i= 0; i < n; i++)
+    if (lf_hash_delete(&hash, pins, &i, sizeof i))
+      missing++;
+  report("lf_hash_delete", start, n, "op");
+
+  lf_hash_put_pins(pins);
+  lf_hash_destroy(&hash);
+  ok(!missing, "lf_hash found all keys");
+}
+
+int main(int argc, char **argv)
+{
+  MY_INIT(argv[0]);
+  if (argc > 1 && atoi(argv[1]) > 0)
+    scale= (uint) atoi(argv[1]);
+
+  plan(4);
+  bench_crc();
+  bench_alloc_root();
+  bench_lf_hash();
+
+  my_end(0);
+  return exit_status();
+}
@@ -0,0 +1,77 @@
+/* Copyright (c) 2026, MariaDB Corporation
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <my_rnd.h>
+#include "tap.h"
+
+#define N_ELEMENTS 150000
+
+static uchar data[N_ELEMENTS * 64];
+static uchar *ptrs[N_ELEMENTS], *buffer[N_ELEMENTS];
+
+/*
+  Fill N_ELEMENTS strings of the given size, of which the first
+  prefix bytes are equal and the following bytes are from [0, n_values).
+  Then sort them and check the result.
+*/
+static my_bool test_sort(struct my_rnd_struct *rnd, size_t size,
+                         size_t prefix, uint n_values)
+{
+  size_t i, j;
+  ulonglong sum= 0, sorted_sum= 0;
+
+  for (i= 0; i < N_ELEMENTS; i++)
+  {
+    uchar *s= data + i * size;
+    for (j= 0; j < size; j++)
+      s[j]= j < prefix ? 'x' : (uchar) (my_rnd(rnd) * n_values);
+    ptrs[i]= s;
+    sum+= (size_t) s;
+  }
+
+  radixsort_msd_for_str_ptr(ptrs, N_ELEMENTS, size, buffer);
+
+  for (i= 0; i < N_ELEMENTS; i++)
+  {
+    sorted_sum+= (size_t) ptrs[i];
+    if (i && memcmp(ptrs[i - 1], ptrs[i], size) > 0)
+    {
+      diag("element %zu is out of order", i);
+      return 0;
+    }
+  }
+  return sum == sorted_sum;
+}
+
+int main(int argc __attribute__((unused)), char *argv[])
+{
+  struct my_rnd_struct rnd;
+  MY_INIT(argv[0]);
+  plan(6);
+
+  my_rnd_init(&rnd, 1, 2);
+
+  ok(radixsort_msd_is_applicable(N_ELEMENTS, 8), "applicable to 8 bytes");
+  ok(!radixsort_msd_is_applicable(1000, 8), "not applicable to 1000 rows");
+  ok(test_sort(&rnd, 4, 0, 256), "random 4-byte keys");
+  ok(test_sort(&rnd, 16, 0, 3), "16-byte keys with many duplicates");
+  ok(test_sort(&rnd, 20, 12, 256), "20-byte keys with a common prefix");
+  ok(test_sort(&rnd, 64, 0, 1), "64-byte equal keys");
+
+  my_end(0);
+  return exit_status();
+}
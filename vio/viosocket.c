@@ -286,6 +286,46 @@ size_t vio_write(Vio *vio, const uchar* buf, size_t size)
   DBUG_RETURN(ret);
 }
 
+#ifdef HAVE_VIO_WRITEV
+/*
+  Write the buffers of iov with one system call when possible.
+  Returns the number of bytes written, which may be less than the total
+  length of the buffers, or -1 on error, like vio_write().
+*/
+
+size_t vio_writev(Vio *vio, const struct iovec *iov, int iovcnt)
+{
+  ssize_t ret;
+  int flags= 0;
+  struct msghdr msg;
+  DBUG_ENTER("vio_writev");
+  DBUG_PRINT("enter", ("sd: %d  iovcnt: %d",
+                       (int)mysql_socket_getfd(vio->mysql_socket), iovcnt));
+
+  bzero(&msg, sizeof(msg));
+  msg.msg_iov= (struct iovec*) iov;
+  msg.msg_iovlen= iovcnt;
+
+  /* If timeout is enabled, do not block. */
+  if (vio->write_timeout >= 0)
+    flags= VIO_DONTWAIT;
+
+  while ((ret= mysql_socket_sendmsg(vio->mysql_socket, &msg, flags)) == -1)
+  {
+    int error= socket_errno;
+    /* The operation would block? */
+    if (error != SOCKET_EAGAIN && error != SOCKET_EWOULDBLOCK)
+      break;
+
+    /* Wait for the output buffer to become writable.*/
+    if ((ret= vio_socket_io_wait(vio, VIO_IO_EVENT_WRITE)))
+      break;
+  }
+  DBUG_PRINT("exit", ("%d", (int) ret));
+  DBUG_RETURN(ret);
+}
+#endif /* HAVE_VIO_WRITEV */
+
 int vio_socket_shutdown(Vio *vio, int how)
 {
   int ret;